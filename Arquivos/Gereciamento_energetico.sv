@@ -11,9 +11,26 @@
 // - Botão A → freio regenerativo.
 // - Botão B → alterna estado da bateria (cheia/baixa).
 // - FPGA devolve código de 3 bits (modo operacional) lido pelo Pico.
+// - Entradas assíncronas passam por sincronizador + filtro de glitch
+//   antes da FSM (ver input_sync_filter).
+// - Cada troca de modo é registrada com timestamp em ciclos numa
+//   FIFO em BRAM (ver event_fifo).
+// - Interface SPI escrava com banco de registradores: o Pico lê
+//   modo, entradas, contadores, estatísticas e eventos e escreve a
+//   configuração (ver spi_slave_regs).
 // ============================================================
 
-module energy_system_all_in_one (
+module energy_system_all_in_one #(
+    // Flip-flops de sincronização por entrada (mínimo 2)
+    parameter SYNC_STAGES    = 2,
+    // Ciclos consecutivos que uma entrada precisa manter o novo valor
+    // para ser aceita (0 = sem filtro, só sincronização)
+    parameter FILTER_DEMAND  = 4,   // p_demand_low, p_demand_high, p_idle
+    parameter FILTER_BRAKING = 4,   // is_braking
+    parameter FILTER_BATTERY = 4,   // battery_button
+    // Profundidade da FIFO de eventos = 2^EVENT_ADDR_WIDTH
+    parameter EVENT_ADDR_WIDTH = 9    // máximo 15 (EVT_NIVEL tem 16 bits)
+) (
     input  wire clk,
     input  wire reset_n,
 
@@ -29,9 +46,66 @@ module energy_system_all_in_one (
     // Saídas - modo operacional (FPGA → Pico)
     output wire operating_mode0,  // G20 → GP28 (vermelho)
     output wire operating_mode1,  // L18 → GP16 (verde)
-    output wire operating_mode2   // L20 → GP17 (azul)
+    output wire operating_mode2,  // L20 → GP17 (azul)
+
+    // Interface SPI (Pico mestre, modo 0)
+    input  wire spi_sclk,         // GP2  → A2
+    input  wire spi_cs_n,         // GP1  → C2
+    input  wire spi_mosi,         // GP3  → D1
+    output wire spi_miso          // E1   → GP4
 );
 
+    // ============================================================
+    // SINCRONIZAÇÃO E FILTRO DAS ENTRADAS
+    // ============================================================
+    // Latência adicionada por entrada, em ciclos de clk, entre a borda
+    // que amostra a mudança no pino e a borda em que a FSM a enxerga.
+    // Pulsos mais curtos que FILTER_* ciclos são descartados.
+    // ============================================================
+    localparam LATENCY_DEMAND  = SYNC_STAGES + FILTER_DEMAND;
+    localparam LATENCY_BRAKING = SYNC_STAGES + FILTER_BRAKING;
+    localparam LATENCY_BATTERY = SYNC_STAGES + FILTER_BATTERY;
+
+    wire demand_low_f, demand_high_f, idle_f;
+    wire braking_f;
+    wire battery_button_f;
+
+    input_sync_filter #(
+        .WIDTH(3),
+        .SYNC_STAGES(SYNC_STAGES),
+        .FILTER_CYCLES(FILTER_DEMAND),
+        .RESET_VALUE(3'b000)            // pull-down nos pinos
+    ) u_sync_demand (
+        .clk(clk),
+        .reset_n(reset_n),
+        .async_in({p_idle, p_demand_high, p_demand_low}),
+        .filtered_out({idle_f, demand_high_f, demand_low_f})
+    );
+
+    input_sync_filter #(
+        .WIDTH(1),
+        .SYNC_STAGES(SYNC_STAGES),
+        .FILTER_CYCLES(FILTER_BRAKING),
+        .RESET_VALUE(1'b0)              // pull-down no pino
+    ) u_sync_braking (
+        .clk(clk),
+        .reset_n(reset_n),
+        .async_in(is_braking),
+        .filtered_out(braking_f)
+    );
+
+    input_sync_filter #(
+        .WIDTH(1),
+        .SYNC_STAGES(SYNC_STAGES),
+        .FILTER_CYCLES(FILTER_BATTERY),
+        .RESET_VALUE(1'b1)              // pull-up: solto = bateria cheia
+    ) u_sync_battery (
+        .clk(clk),
+        .reset_n(reset_n),
+        .async_in(battery_button),
+        .filtered_out(battery_button_f)
+    );
+
     // ============================================================
     // LÓGICA DE BATERIA CONTROLADA PELO BOTÃO B
     // ============================================================
@@ -40,31 +114,515 @@ module energy_system_all_in_one (
     // - Solto → simula bateria CHEIA → opera normalmente no modo elétrico.
     // ============================================================
 
-    wire battery_low  = ~battery_button;  // botão pressionado = bateria fraca
-    wire battery_high =  battery_button;  // botão solto = bateria cheia
-    wire battery_full =  battery_button;  // mesmo sinal (FSM compatível)
+    wire battery_low  = ~battery_button_f;  // botão pressionado = bateria fraca
+    wire battery_high =  battery_button_f;  // botão solto = bateria cheia
+    wire battery_full =  battery_button_f;  // mesmo sinal (FSM compatível)
 
     // ============================================================
     // INSTÂNCIA DO GERENCIADOR DE ENERGIA PRINCIPAL
     // ============================================================
+    wire       mode_change;
+    wire [2:0] mode_next;
+
+    // Estatísticas por modo, lidas pela interface SPI
+    wire        stats_clear;
+    wire [6:0]  stats_addr;
+    wire [31:0] stats_data;
+
     energy_manager_fixed u_energy (
         .clk(clk),
         .reset_n(reset_n),
-        .p_demand_low(p_demand_low),
-        .p_demand_high(p_demand_high),
-        .p_idle(p_idle),
-        .is_braking(is_braking),
+        .p_demand_low(demand_low_f),
+        .p_demand_high(demand_high_f),
+        .p_idle(idle_f),
+        .is_braking(braking_f),
         .battery_low(battery_low),
         .battery_high(battery_high),
         .battery_full(battery_full),
         .operating_mode0(operating_mode0),
         .operating_mode1(operating_mode1),
-        .operating_mode2(operating_mode2)
+        .operating_mode2(operating_mode2),
+        .mode_change(mode_change),
+        .mode_next(mode_next),
+        .stats_clear(stats_clear),
+        .stats_addr(stats_addr),
+        .stats_data(stats_data)
+    );
+
+    // ============================================================
+    // REGISTRO DE EVENTOS (troca de modo + timestamp)
+    // ============================================================
+    // Contador livre de ciclos desde o reset.  Cada evento é gravado
+    // na mesma borda em que current_mode muda, com o valor do
+    // contador nessa borda.  Formato (43 bits):
+    //   [42:11] timestamp  [10:8] modo antigo  [7:5] modo novo
+    //   [4:0]   entradas filtradas {battery_button, is_braking,
+    //           p_idle, p_demand_high, p_demand_low}
+    // A leitura (evt_rd_en / evt_rd_data) é feita pela interface
+    // SPI, que também pode desligar o registro (cfg_eventos).
+    // ============================================================
+    localparam EVENT_WIDTH = 43;
+
+    reg [31:0] cycle_count;
+
+    always @(posedge clk or negedge reset_n) begin
+        if (!reset_n)
+            cycle_count <= 32'd0;
+        else
+            cycle_count <= cycle_count + 32'd1;
+    end
+
+    wire                      evt_rd_en;
+    wire [EVENT_WIDTH-1:0]    evt_rd_data;
+    wire                      evt_rd_valid;
+    wire                      evt_empty;
+    wire                      evt_full;
+    wire [EVENT_ADDR_WIDTH:0] evt_level;
+    wire [15:0]               evt_dropped;
+    wire                      cfg_eventos;
+
+    event_fifo #(
+        .WIDTH(EVENT_WIDTH),
+        .ADDR_WIDTH(EVENT_ADDR_WIDTH)
+    ) u_eventos (
+        .clk(clk),
+        .reset_n(reset_n),
+        .wr_en(mode_change && cfg_eventos),
+        .wr_data({cycle_count,
+                  operating_mode2, operating_mode1, operating_mode0,
+                  mode_next,
+                  battery_button_f, braking_f, idle_f, demand_high_f, demand_low_f}),
+        .rd_en(evt_rd_en),
+        .rd_data(evt_rd_data),
+        .rd_valid(evt_rd_valid),
+        .empty(evt_empty),
+        .full(evt_full),
+        .level(evt_level),
+        .dropped(evt_dropped)
+    );
+
+    // ============================================================
+    // INTERFACE SPI (registradores de configuração e telemetria)
+    // ============================================================
+    spi_slave_regs u_spi (
+        .clk(clk),
+        .reset_n(reset_n),
+        .spi_sclk(spi_sclk),
+        .spi_cs_n(spi_cs_n),
+        .spi_mosi(spi_mosi),
+        .spi_miso(spi_miso),
+        .modo({operating_mode2, operating_mode1, operating_mode0}),
+        .entradas({battery_button_f, braking_f, idle_f, demand_high_f, demand_low_f}),
+        .ciclos(cycle_count),
+        .evt_rd_en(evt_rd_en),
+        .evt_rd_data(evt_rd_data),
+        .evt_rd_valid(evt_rd_valid),
+        .evt_full(evt_full),
+        .evt_level({{(15 - EVENT_ADDR_WIDTH){1'b0}}, evt_level}),
+        .evt_dropped(evt_dropped),
+        .stats_clear(stats_clear),
+        .stats_addr(stats_addr),
+        .stats_data(stats_data),
+        .cfg_eventos(cfg_eventos)
     );
 
 endmodule
 
 
+// ============================================================
+// MÓDULO INTERNO: input_sync_filter
+// ============================================================
+// Sincronizador de SYNC_STAGES flip-flops seguido de um filtro de
+// glitch por bit: a saída só troca de valor depois que a entrada
+// sincronizada se mantém diferente dela por FILTER_CYCLES ciclos
+// seguidos.  Uma mudança amostrada na borda k aparece na saída na
+// borda k + SYNC_STAGES + FILTER_CYCLES - 1, ou seja, a FSM passa a
+// vê-la LATENCY ciclos depois do que veria ligada direto ao pino.
+// ============================================================
+
+module input_sync_filter #(
+    parameter WIDTH         = 1,
+    parameter SYNC_STAGES   = 2,
+    parameter FILTER_CYCLES = 4,
+    parameter [WIDTH-1:0] RESET_VALUE = {WIDTH{1'b0}}
+) (
+    input  wire             clk,
+    input  wire             reset_n,
+    input  wire [WIDTH-1:0] async_in,
+    output wire [WIDTH-1:0] filtered_out
+);
+
+    localparam LATENCY = SYNC_STAGES + FILTER_CYCLES;
+    localparam CNT_W   = (FILTER_CYCLES > 1) ? $clog2(FILTER_CYCLES) : 1;
+
+    // synthesis translate_off
+    initial begin
+        if (SYNC_STAGES < 2) begin
+            $display("input_sync_filter: SYNC_STAGES deve ser >= 2");
+            $finish;
+        end
+    end
+    // synthesis translate_on
+
+    // ============================================================
+    // SINCRONIZADOR (cadeia de flip-flops)
+    // ============================================================
+    reg [WIDTH-1:0] sync_chain [0:SYNC_STAGES-1] /* synthesis syn_preserve = 1 */;
+    wire [WIDTH-1:0] synced = sync_chain[SYNC_STAGES-1];
+
+    integer s;
+    always @(posedge clk or negedge reset_n) begin
+        if (!reset_n) begin
+            for (s = 0; s < SYNC_STAGES; s = s + 1)
+                sync_chain[s] <= RESET_VALUE;
+        end else begin
+            sync_chain[0] <= async_in;
+            for (s = 1; s < SYNC_STAGES; s = s + 1)
+                sync_chain[s] <= sync_chain[s-1];
+        end
+    end
+
+    // ============================================================
+    // FILTRO DE GLITCH (contador por bit)
+    // ============================================================
+    genvar i;
+    generate
+        if (FILTER_CYCLES == 0) begin : g_sem_filtro
+            assign filtered_out = synced;
+        end else begin : g_filtro
+            for (i = 0; i < WIDTH; i = i + 1) begin : g_bit
+                reg [CNT_W-1:0] count;
+                reg             stable;
+
+                always @(posedge clk or negedge reset_n) begin
+                    if (!reset_n) begin
+                        count  <= {CNT_W{1'b0}};
+                        stable <= RESET_VALUE[i];
+                    end else if (synced[i] == stable) begin
+                        count  <= {CNT_W{1'b0}};      // sem mudança pendente
+                    end else if (count == FILTER_CYCLES - 1) begin
+                        count  <= {CNT_W{1'b0}};
+                        stable <= synced[i];          // mudança aceita
+                    end else begin
+                        count  <= count + 1'b1;
+                    end
+                end
+
+                assign filtered_out[i] = stable;
+            end
+        end
+    endgenerate
+
+endmodule
+
+
+// ============================================================
+// MÓDULO INTERNO: event_fifo
+// ============================================================
+// FIFO síncrona de 2^ADDR_WIDTH palavras, inferida em BRAM (DP16KD
+// no ECP5).  Leitura first-word fall-through: rd_data mostra a
+// palavra mais antiga sempre que rd_valid = 1, sem retirá-la; rd_en
+// a retira e a seguinte aparece no próximo ciclo.  Uma escrita na
+// FIFO vazia leva dois ciclos para aparecer em rd_data.  Com a FIFO
+// cheia a escrita é descartada e contada em dropped (satura em
+// 16'hFFFF).
+// ============================================================
+
+module event_fifo #(
+    parameter WIDTH      = 43,
+    parameter ADDR_WIDTH = 9
+) (
+    input  wire                  clk,
+    input  wire                  reset_n,
+
+    input  wire                  wr_en,
+    input  wire [WIDTH-1:0]      wr_data,
+
+    input  wire                  rd_en,
+    output reg  [WIDTH-1:0]      rd_data,
+    output reg                   rd_valid,
+
+    output wire                  empty,
+    output wire                  full,
+    output wire [ADDR_WIDTH:0]   level,
+    output reg  [15:0]           dropped
+);
+
+    reg [WIDTH-1:0] mem [0:(1 << ADDR_WIDTH) - 1] /* synthesis syn_ramstyle = "block_ram" */;
+
+    // Ponteiros com um bit extra para distinguir cheia de vazia
+    reg [ADDR_WIDTH:0] wr_ptr, rd_ptr;
+
+    assign level = wr_ptr - rd_ptr;
+    assign empty = (wr_ptr == rd_ptr);
+    assign full  = level[ADDR_WIDTH];
+
+    wire do_write = wr_en && !full;
+    wire do_read  = rd_en && rd_valid;
+
+    wire [ADDR_WIDTH:0] wr_ptr_prox = wr_ptr + {{ADDR_WIDTH{1'b0}}, do_write};
+    wire [ADDR_WIDTH:0] rd_ptr_prox = rd_ptr + {{ADDR_WIDTH{1'b0}}, do_read};
+
+    // ============================================================
+    // MEMÓRIA (sem reset, para inferir BRAM)
+    // ============================================================
+    // A porta de leitura lê a cabeça a cada ciclo.  Se ela está sendo
+    // escrita na mesma borda, a BRAM devolve o valor antigo, então
+    // rd_valid espera a releitura no ciclo seguinte.
+    always @(posedge clk) begin
+        if (do_write)
+            mem[wr_ptr[ADDR_WIDTH-1:0]] <= wr_data;
+        rd_data <= mem[rd_ptr_prox[ADDR_WIDTH-1:0]];
+    end
+
+    // ============================================================
+    // PONTEIROS E CONTADOR DE DESCARTES
+    // ============================================================
+    always @(posedge clk or negedge reset_n) begin
+        if (!reset_n) begin
+            wr_ptr   <= {(ADDR_WIDTH + 1){1'b0}};
+            rd_ptr   <= {(ADDR_WIDTH + 1){1'b0}};
+            rd_valid <= 1'b0;
+            dropped  <= 16'd0;
+        end else begin
+            wr_ptr   <= wr_ptr_prox;
+            rd_ptr   <= rd_ptr_prox;
+            rd_valid <= (wr_ptr_prox != rd_ptr_prox) && !(do_write && wr_ptr == rd_ptr_prox);
+            if (wr_en && full && dropped != 16'hFFFF)
+                dropped <= dropped + 16'd1;
+        end
+    end
+
+endmodule
+
+
+// ============================================================
+// MÓDULO INTERNO: spi_slave_regs
+// ============================================================
+// Escravo SPI (modo 0: CPOL = 0, CPHA = 0, MSB primeiro) com um
+// banco de registradores de 32 bits.  SCLK, CS_N e MOSI passam por
+// sincronizadores de 2 flip-flops no clk do FPGA, por isso SCLK
+// deve ser no máximo clk/8 (3,125 MHz com clk de 25 MHz).
+//
+// Transação (CS_N em nível baixo do início ao fim):
+//   1º byte : comando {escrita, endereço[6:0]}.  Enquanto ele entra,
+//             MISO devolve o status rápido {evento disponível,
+//             FIFO cheia, 3'b000, modo[2:0]}.
+//   depois  : palavras de 32 bits, MSB primeiro, a partir do
+//             endereço, com incremento automático até CS_N subir.
+//             Numa escrita, cada palavra é gravada ao chegar o 32º
+//             bit; palavras incompletas são descartadas.
+//
+// Mapa de registradores:
+//   0x00 ID        L   32'h454D_0001 ("EM", versão 1)
+//   0x01 STATUS    L   [2:0] modo  [8] evento disponível  [9] FIFO cheia
+//   0x02 ENTRADAS  L   [4:0] entradas filtradas {battery_button,
+//                      is_braking, p_idle, p_demand_high, p_demand_low}
+//   0x03 CICLOS    L   contador livre de ciclos
+//   0x04 EVT_NIVEL L   [15:0] eventos na FIFO  [31:16] descartados
+//   0x05 CONFIG    L/E [0] registro de eventos ligado (1 no reset)
+//   0x06 CONTROLE  E   [0] zera as estatísticas (lê 0)
+//   0x07 SCRATCH   L/E livre, para testar o enlace
+//   0x08 EVT_TS    L   timestamp do evento mais antigo (0 com a FIFO
+//                      vazia); o evento sai da FIFO quando o mestre
+//                      começa a ler esta palavra
+//   0x09 EVT_INFO  L   [31] válido  [10:0] modos e entradas do evento
+//                      da última leitura de EVT_TS
+//   0x10-0x14      L   residency[m]
+//   0x40-0x7F      L   transitions[a][b] (0x40 | a << 3 | b)
+// Depois de EVT_INFO o endereço volta para EVT_TS, então uma leitura
+// em rajada a partir de 0x08 esvazia a FIFO em pares TS/INFO.
+// ============================================================
+
+module spi_slave_regs #(
+    parameter [31:0] ID = 32'h454D_0001
+) (
+    input  wire        clk,
+    input  wire        reset_n,
+
+    // Pinos SPI
+    input  wire        spi_sclk,
+    input  wire        spi_cs_n,
+    input  wire        spi_mosi,
+    output wire        spi_miso,
+
+    // Telemetria
+    input  wire [2:0]  modo,
+    input  wire [4:0]  entradas,
+    input  wire [31:0] ciclos,
+
+    // FIFO de eventos (first-word fall-through, ver event_fifo)
+    output wire        evt_rd_en,
+    input  wire [42:0] evt_rd_data,
+    input  wire        evt_rd_valid,
+    input  wire        evt_full,
+    input  wire [15:0] evt_level,
+    input  wire [15:0] evt_dropped,
+
+    // Estatísticas (ver energy_manager_fixed)
+    output reg         stats_clear,
+    output reg  [6:0]  stats_addr,
+    input  wire [31:0] stats_data,
+
+    // Configuração
+    output reg         cfg_eventos
+);
+
+    localparam REG_ID        = 7'h00;
+    localparam REG_STATUS    = 7'h01;
+    localparam REG_ENTRADAS  = 7'h02;
+    localparam REG_CICLOS    = 7'h03;
+    localparam REG_EVT_NIVEL = 7'h04;
+    localparam REG_CONFIG    = 7'h05;
+    localparam REG_CONTROLE  = 7'h06;
+    localparam REG_SCRATCH   = 7'h07;
+    localparam REG_EVT_TS    = 7'h08;
+    localparam REG_EVT_INFO  = 7'h09;
+
+    // ============================================================
+    // SINCRONIZAÇÃO DOS PINOS
+    // ============================================================
+    // Bit [1] é o valor sincronizado e [2] o do ciclo anterior, para
+    // detectar bordas.  MOSI tem a mesma latência que SCLK.
+    reg [2:0] sclk_r;
+    reg [2:0] cs_r;
+    reg [1:0] mosi_r;
+
+    wire sclk_sobe = sclk_r[1] && !sclk_r[2];
+    wire cs_ativo  = !cs_r[1];
+    wire cs_desce  = !cs_r[1] && cs_r[2];
+    wire mosi_s    = mosi_r[1];
+
+    // ============================================================
+    // REGISTRADORES DE DESLOCAMENTO E ESTADO DA TRANSAÇÃO
+    // ============================================================
+    reg        fase_cmd;      // 1 enquanto recebe o byte de comando
+    reg        escrita;
+    reg [4:0]  bit_cnt;
+    reg [31:0] sr_in;
+    reg [31:0] sr_out;
+    reg [6:0]  addr;
+    reg        retirar_evt;   // EVT_TS carregado: retira o evento no 1º bit
+    reg        evt_valido;
+    reg [10:0] evt_info;
+    reg [31:0] scratch;
+
+    assign spi_miso = sr_out[31];
+
+    wire [6:0]  cmd_addr    = {sr_in[5:0], mosi_s};
+    wire [31:0] palavra     = {sr_in[30:0], mosi_s};
+    wire        fim_cmd     = fase_cmd && bit_cnt == 5'd7;
+    wire        fim_palavra = !fase_cmd && bit_cnt == 5'd31;
+
+    // Endereço da próxima palavra (EVT_INFO volta para EVT_TS)
+    wire [6:0] addr_prox  = (addr == REG_EVT_INFO) ? REG_EVT_TS : addr + 7'd1;
+    wire [6:0] addr_carga = fase_cmd ? cmd_addr : addr_prox;
+
+    // Borda de SCLK em que o mestre acabou de ler o último bit e a
+    // próxima palavra de leitura precisa ir para sr_out
+    wire carga_leitura = cs_ativo && sclk_sobe &&
+                         ((fim_cmd && !sr_in[6]) || (fim_palavra && !escrita));
+
+    // Uma palavra é carregada antes de o mestre decidir se vai lê-la,
+    // então o evento só sai da FIFO na primeira borda de EVT_TS; uma
+    // rajada que termina logo antes dela não perde o evento.
+    assign evt_rd_en = retirar_evt && cs_ativo && !cs_desce && sclk_sobe;
+
+    // ============================================================
+    // LEITURA DOS REGISTRADORES
+    // ============================================================
+    reg [31:0] rdata;
+
+    always @(*) begin
+        stats_addr = addr_carga[6] ? addr_carga : {4'b0000, addr_carga[2:0]};
+
+        case (addr_carga)
+            REG_ID:        rdata = ID;
+            REG_STATUS:    rdata = {22'd0, evt_full, evt_rd_valid, 5'd0, modo};
+            REG_ENTRADAS:  rdata = {27'd0, entradas};
+            REG_CICLOS:    rdata = ciclos;
+            REG_EVT_NIVEL: rdata = {evt_dropped, evt_level};
+            REG_CONFIG:    rdata = {31'd0, cfg_eventos};
+            REG_SCRATCH:   rdata = scratch;
+            REG_EVT_TS:    rdata = evt_rd_valid ? evt_rd_data[42:11] : 32'd0;
+            REG_EVT_INFO:  rdata = evt_valido ? {1'b1, 20'd0, evt_info} : 32'd0;
+            default:       rdata = (addr_carga[6] || addr_carga[6:3] == 4'b0010) ? stats_data : 32'd0;
+        endcase
+    end
+
+    // ============================================================
+    // MÁQUINA DA TRANSAÇÃO
+    // ============================================================
+    always @(posedge clk or negedge reset_n) begin
+        if (!reset_n) begin
+            sclk_r      <= 3'b000;
+            cs_r        <= 3'b111;
+            mosi_r      <= 2'b00;
+            fase_cmd    <= 1'b1;
+            escrita     <= 1'b0;
+            bit_cnt     <= 5'd0;
+            sr_in       <= 32'd0;
+            sr_out      <= 32'd0;
+            addr        <= 7'd0;
+            retirar_evt <= 1'b0;
+            evt_valido  <= 1'b0;
+            evt_info    <= 11'd0;
+            scratch     <= 32'd0;
+            stats_clear <= 1'b0;
+            cfg_eventos <= 1'b1;
+        end else begin
+            sclk_r      <= {sclk_r[1:0], spi_sclk};
+            cs_r        <= {cs_r[1:0], spi_cs_n};
+            mosi_r      <= {mosi_r[0], spi_mosi};
+            stats_clear <= 1'b0;
+
+            if (!cs_ativo) begin
+                fase_cmd    <= 1'b1;
+                bit_cnt     <= 5'd0;
+                retirar_evt <= 1'b0;
+            end else if (cs_desce) begin
+                sr_out   <= {evt_rd_valid, evt_full, 3'b000, modo, 24'd0};
+                fase_cmd <= 1'b1;
+                bit_cnt  <= 5'd0;
+            end else if (sclk_sobe) begin
+                sr_in       <= palavra;
+                sr_out      <= {sr_out[30:0], 1'b0};
+                bit_cnt     <= bit_cnt + 5'd1;
+                retirar_evt <= 1'b0;
+
+                if (fim_cmd) begin
+                    fase_cmd <= 1'b0;
+                    bit_cnt  <= 5'd0;
+                    escrita  <= sr_in[6];
+                    addr     <= cmd_addr;
+                end else if (fim_palavra) begin
+                    bit_cnt <= 5'd0;
+                    addr    <= addr_prox;
+                    if (escrita) begin
+                        case (addr)
+                            REG_CONFIG:   cfg_eventos <= palavra[0];
+                            REG_CONTROLE: stats_clear <= palavra[0];
+                            REG_SCRATCH:  scratch     <= palavra;
+                            default: ;
+                        endcase
+                    end
+                end
+
+                if (carga_leitura) begin
+                    sr_out <= rdata;
+                    if (addr_carga == REG_EVT_TS) begin
+                        retirar_evt <= evt_rd_valid;
+                        evt_valido  <= evt_rd_valid;
+                        evt_info    <= evt_rd_data[10:0];
+                    end
+                end
+            end
+        end
+    end
+
+endmodule
+
+
 // ============================================================
 // MÓDULO INTERNO: energy_manager_fixed
 // ============================================================
@@ -88,7 +646,16 @@ module energy_manager_fixed (
     // Saídas (código de 3 bits do modo operacional)
     output reg operating_mode0,
     output reg operating_mode1,
-    output reg operating_mode2
+    output reg operating_mode2,
+
+    // Troca de modo na próxima borda (para o registro de eventos)
+    output wire       mode_change,
+    output wire [2:0] mode_next,
+
+    // Estatísticas (ver ESTATÍSTICAS abaixo)
+    input  wire        stats_clear,
+    input  wire [6:0]  stats_addr,
+    output reg  [31:0] stats_data
 );
 
     // ============================================================
@@ -185,4 +752,56 @@ module energy_manager_fixed (
         {operating_mode2, operating_mode1, operating_mode0} = current_mode;
     end
 
+    assign mode_change = (next_mode != current_mode);
+    assign mode_next   = next_mode;
+
+    // ============================================================
+    // ESTATÍSTICAS
+    // ============================================================
+    // residency[m]       : ciclos passados no modo m
+    // transitions[a*5+b] : trocas do modo a para o modo b
+    // Contadores de 32 bits que dão a volta (a 25 MHz a residência
+    // dá a volta em ~171 s); stats_clear zera todos.
+    //
+    // Mapa de leitura (stats_addr):
+    //   7'b0000_mmm : residency[mmm]
+    //   7'b1_aaa_bbb: transitions[aaa][bbb]
+    //   demais      : 0
+    // ============================================================
+    localparam NUM_MODES = 5;
+
+    reg [31:0] residency   [0:NUM_MODES-1];
+    reg [31:0] transitions [0:NUM_MODES*NUM_MODES-1];
+
+    integer m;
+    always @(posedge clk or negedge reset_n) begin
+        if (!reset_n) begin
+            for (m = 0; m < NUM_MODES; m = m + 1)
+                residency[m] <= 32'd0;
+            for (m = 0; m < NUM_MODES * NUM_MODES; m = m + 1)
+                transitions[m] <= 32'd0;
+        end else if (stats_clear) begin
+            for (m = 0; m < NUM_MODES; m = m + 1)
+                residency[m] <= 32'd0;
+            for (m = 0; m < NUM_MODES * NUM_MODES; m = m + 1)
+                transitions[m] <= 32'd0;
+        end else begin
+            if (current_mode < NUM_MODES)
+                residency[current_mode] <= residency[current_mode] + 32'd1;
+            if (mode_change && current_mode < NUM_MODES && next_mode < NUM_MODES)
+                transitions[current_mode * NUM_MODES + next_mode] <=
+                    transitions[current_mode * NUM_MODES + next_mode] + 32'd1;
+        end
+    end
+
+    always @(*) begin
+        stats_data = 32'd0;
+        if (stats_addr[6]) begin
+            if (stats_addr[5:3] < NUM_MODES && stats_addr[2:0] < NUM_MODES)
+                stats_data = transitions[stats_addr[5:3] * NUM_MODES + stats_addr[2:0]];
+        end else if (stats_addr[5:3] == 3'b000 && stats_addr[2:0] < NUM_MODES) begin
+            stats_data = residency[stats_addr[2:0]];
+        end
+    end
+
 endmodule
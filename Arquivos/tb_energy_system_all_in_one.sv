@@ -15,6 +15,59 @@ module tb_energy_system_all_in_one;
     wire operating_mode0;
     wire operating_mode1;
     wire operating_mode2;
+    wire [2:0] modo = {operating_mode2, operating_mode1, operating_mode0};
+
+    // Interface SPI (o testbench faz o papel do Pico, modo 0)
+    reg  spi_sclk = 0;
+    reg  spi_cs_n = 1;
+    reg  spi_mosi = 0;
+    wire spi_miso;
+    localparam SPI_MEIO = 50;       // SCLK = clk/10
+    reg [7:0]  spi_status;
+    reg [31:0] spi_palavra;
+    reg [31:0] spi_buf [0:63];
+
+    // Verificação do front end de entradas
+    integer ciclos;
+    integer erros = 0;
+
+    // Monitor de trocas de modo (confere o registro de eventos)
+    integer ciclo = 0;
+    integer trocas = 0;
+    integer ciclo_troca [0:63];
+    reg [2:0] modo_ant = 3'b000;
+    integer i;
+    integer j;
+    reg [42:0] evento;
+    reg [42:0] evento_ant;
+
+    // Estatísticas esperadas (residência e matriz de transições)
+    integer ciclo_ultimo = 0;
+    integer resid_tb [0:4];
+    integer trans_tb [0:4][0:4];
+
+    initial begin
+        for (i = 0; i < 5; i = i + 1) begin
+            resid_tb[i] = 0;
+            for (j = 0; j < 5; j = j + 1)
+                trans_tb[i][j] = 0;
+        end
+    end
+
+    always @(posedge clk)
+        ciclo = ciclo + 1;
+
+    always @(modo) begin
+        if (reset_n === 1'b1 && modo !== modo_ant) begin
+            if (trocas < 64)
+                ciclo_troca[trocas] = ciclo;
+            trocas = trocas + 1;
+            resid_tb[modo_ant] = resid_tb[modo_ant] + ciclo - ciclo_ultimo;
+            trans_tb[modo_ant][modo] = trans_tb[modo_ant][modo] + 1;
+            ciclo_ultimo = ciclo;
+            modo_ant = modo;
+        end
+    end
 
     // Instância do DUT
     energy_system_all_in_one uut (
@@ -27,9 +80,55 @@ module tb_energy_system_all_in_one;
         .battery_button(battery_button),
         .operating_mode0(operating_mode0),
         .operating_mode1(operating_mode1),
-        .operating_mode2(operating_mode2)
+        .operating_mode2(operating_mode2),
+        .spi_sclk(spi_sclk),
+        .spi_cs_n(spi_cs_n),
+        .spi_mosi(spi_mosi),
+        .spi_miso(spi_miso)
     );
 
+    // ========================================================
+    // Mestre SPI: n bits MSB primeiro, MISO lido na subida
+    // ========================================================
+    task spi_bits(input integer n, input [31:0] tx, output [31:0] rx);
+        integer b;
+        begin
+            rx = 32'd0;
+            for (b = n - 1; b >= 0; b = b - 1) begin
+                spi_mosi = tx[b];
+                #SPI_MEIO;
+                spi_sclk = 1;
+                rx[b] = spi_miso;
+                #SPI_MEIO;
+                spi_sclk = 0;
+            end
+        end
+    endtask
+
+    // Lê n palavras a partir de addr para spi_buf
+    task spi_ler(input [6:0] addr, input integer n);
+        integer k;
+        begin
+            spi_cs_n = 0; #SPI_MEIO;
+            spi_bits(8, {25'd0, addr}, spi_palavra);
+            spi_status = spi_palavra[7:0];
+            for (k = 0; k < n; k = k + 1) begin
+                spi_bits(32, 32'd0, spi_palavra);
+                spi_buf[k] = spi_palavra;
+            end
+            #SPI_MEIO; spi_cs_n = 1; #(2 * SPI_MEIO);
+        end
+    endtask
+
+    task spi_escrever(input [6:0] addr, input [31:0] dado);
+        begin
+            spi_cs_n = 0; #SPI_MEIO;
+            spi_bits(8, {24'd0, 1'b1, addr}, spi_palavra);
+            spi_bits(32, dado, spi_palavra);
+            #SPI_MEIO; spi_cs_n = 1; #(2 * SPI_MEIO);
+        end
+    endtask
+
     // Clock
     initial clk = 0;
     always #5 clk = ~clk;   // 100 MHz
@@ -48,6 +147,7 @@ module tb_energy_system_all_in_one;
         battery_button = 1; // 1 = bateria cheia
         #20;
         reset_n = 1;
+        ciclo_ultimo = ciclo;   // a residência conta a partir daqui
 
         // IDLE
         p_idle = 1; #50;
@@ -80,7 +180,189 @@ module tb_energy_system_all_in_one;
         is_braking = 1; #50;
         is_braking = 0; #50;
 
+        // ========================================================
+        // Filtro de glitch e latência das entradas
+        // ========================================================
+        // Espera a volta ao modo elétrico após a frenagem
+        repeat (uut.LATENCY_BRAKING + 2) @(posedge clk);
+        #1;
+        if (modo !== 3'b001) begin
+            $display("ERRO: modo %b antes do teste de glitch (esperado 001)", modo);
+            erros = erros + 1;
+        end
+
+        // Pulso de freio mais curto que o filtro → deve ser descartado
+        @(negedge clk); is_braking = 1;
+        repeat (uut.FILTER_BRAKING - 1) @(negedge clk);
+        is_braking = 0;
+        repeat (uut.LATENCY_BRAKING + 2) begin
+            @(posedge clk); #1;
+            if (modo !== 3'b001) begin
+                $display("ERRO: glitch de %0d ciclos no freio mudou o modo para %b",
+                         uut.FILTER_BRAKING - 1, modo);
+                erros = erros + 1;
+            end
+        end
+
+        // Latência: sem o front end a FSM reagiria na 1ª borda
+        @(negedge clk); is_braking = 1;
+        ciclos = 0;
+        while (modo !== 3'b100 && ciclos < 100) begin
+            @(posedge clk); #1;
+            ciclos = ciclos + 1;
+        end
+        if (ciclos - 1 != uut.LATENCY_BRAKING) begin
+            $display("ERRO: latência do freio %0d ciclos (esperado %0d)",
+                     ciclos - 1, uut.LATENCY_BRAKING);
+            erros = erros + 1;
+        end
+        is_braking = 0;
+
+        $display("Latência adicionada (ciclos): demanda=%0d freio=%0d bateria=%0d",
+                 uut.LATENCY_DEMAND, uut.LATENCY_BRAKING, uut.LATENCY_BATTERY);
+
         #100;
+
+        // ========================================================
+        // Registro de eventos: um por troca, encadeados e com o
+        // intervalo em ciclos igual ao observado aqui
+        // ========================================================
+        if (uut.evt_level != trocas || trocas > 64) begin
+            $display("ERRO: %0d eventos registrados para %0d trocas de modo",
+                     uut.evt_level, trocas);
+            erros = erros + 1;
+        end else begin
+            for (i = 0; i < trocas; i = i + 1) begin
+                evento = uut.u_eventos.mem[i];
+                if (evento[10:8] !== (i == 0 ? 3'b000 : evento_ant[7:5]) ||
+                    evento[7:5] === evento[10:8]) begin
+                    $display("ERRO: evento %0d com modos %b -> %b", i, evento[10:8], evento[7:5]);
+                    erros = erros + 1;
+                end
+                if (i > 0 && evento[42:11] - evento_ant[42:11] != ciclo_troca[i] - ciclo_troca[i-1]) begin
+                    $display("ERRO: evento %0d a %0d ciclos do anterior (esperado %0d)", i,
+                             evento[42:11] - evento_ant[42:11], ciclo_troca[i] - ciclo_troca[i-1]);
+                    erros = erros + 1;
+                end
+                evento_ant = evento;
+            end
+            $display("Eventos registrados: %0d", trocas);
+        end
+
+        // ========================================================
+        // Estatísticas: residência por modo e matriz de transições
+        // ========================================================
+        resid_tb[modo] = resid_tb[modo] + ciclo - ciclo_ultimo;
+        ciclo_ultimo = ciclo;
+        for (i = 0; i < 5; i = i + 1) begin
+            if (uut.u_energy.residency[i] != resid_tb[i]) begin
+                $display("ERRO: residência no modo %0d = %0d ciclos (esperado %0d)",
+                         i, uut.u_energy.residency[i], resid_tb[i]);
+                erros = erros + 1;
+            end
+            for (j = 0; j < 5; j = j + 1) begin
+                if (uut.u_energy.transitions[i * 5 + j] != trans_tb[i][j]) begin
+                    $display("ERRO: %0d trocas %0d -> %0d (esperado %0d)",
+                             uut.u_energy.transitions[i * 5 + j], i, j, trans_tb[i][j]);
+                    erros = erros + 1;
+                end
+            end
+        end
+        $display("Residência (ciclos): IDLE=%0d ELECTRIC=%0d DIESEL=%0d HYBRID=%0d REGEN=%0d",
+                 resid_tb[0], resid_tb[1], resid_tb[2], resid_tb[3], resid_tb[4]);
+
+        // ========================================================
+        // Interface SPI: registradores, estatísticas e eventos
+        // ========================================================
+        spi_ler(7'h00, 4);      // ID, STATUS, ENTRADAS, CICLOS
+        if (spi_buf[0] !== 32'h454D_0001) begin
+            $display("ERRO: SPI ID = %h", spi_buf[0]);
+            erros = erros + 1;
+        end
+        if (spi_status !== {1'b1, 1'b0, 3'b000, modo} || spi_buf[1] !== {22'd0, 2'b01, 5'd0, modo}) begin
+            $display("ERRO: SPI status rápido %b, STATUS %h (modo %b)", spi_status, spi_buf[1], modo);
+            erros = erros + 1;
+        end
+        if (spi_buf[2] !== {27'd0, battery_button, is_braking, p_idle, p_demand_high, p_demand_low}) begin
+            $display("ERRO: SPI ENTRADAS = %b", spi_buf[2][4:0]);
+            erros = erros + 1;
+        end
+        if (spi_buf[3] > uut.cycle_count || uut.cycle_count - spi_buf[3] > 1000) begin
+            $display("ERRO: SPI CICLOS = %0d (contador em %0d)", spi_buf[3], uut.cycle_count);
+            erros = erros + 1;
+        end
+
+        spi_escrever(7'h07, 32'hA5C3_0F96);
+        spi_ler(7'h07, 1);
+        if (spi_buf[0] !== 32'hA5C3_0F96) begin
+            $display("ERRO: SPI SCRATCH = %h", spi_buf[0]);
+            erros = erros + 1;
+        end
+
+        // Residência dos modos parados não muda mais; a do atual só cresce
+        resid_tb[modo] = resid_tb[modo] + ciclo - ciclo_ultimo;
+        ciclo_ultimo = ciclo;
+        spi_ler(7'h10, 5);
+        for (i = 0; i < 5; i = i + 1) begin
+            if (i == modo ? spi_buf[i] < resid_tb[i] : spi_buf[i] != resid_tb[i]) begin
+                $display("ERRO: SPI residência do modo %0d = %0d (esperado %0d)", i, spi_buf[i], resid_tb[i]);
+                erros = erros + 1;
+            end
+        end
+        for (i = 0; i < 5; i = i + 1) begin
+            spi_ler(7'h40 | (i << 3), 5);
+            for (j = 0; j < 5; j = j + 1) begin
+                if (spi_buf[j] != trans_tb[i][j]) begin
+                    $display("ERRO: SPI %0d trocas %0d -> %0d (esperado %0d)", spi_buf[j], i, j, trans_tb[i][j]);
+                    erros = erros + 1;
+                end
+            end
+        end
+
+        // Eventos: nível, rajada TS/INFO até esvaziar e um par vazio no fim
+        spi_ler(7'h04, 1);
+        if (spi_buf[0] !== trocas) begin
+            $display("ERRO: SPI EVT_NIVEL = %h (esperado %0d eventos)", spi_buf[0], trocas);
+            erros = erros + 1;
+        end
+        if (trocas < 32) begin
+            spi_ler(7'h08, 2 * trocas + 2);
+            for (i = 0; i <= trocas; i = i + 1) begin
+                evento = (i < trocas) ? uut.u_eventos.mem[i] : 43'd0;
+                if (spi_buf[2 * i] !== evento[42:11] ||
+                    spi_buf[2 * i + 1] !== (i < trocas ? {1'b1, 20'd0, evento[10:0]} : 32'd0)) begin
+                    $display("ERRO: SPI evento %0d = %h %h", i, spi_buf[2 * i], spi_buf[2 * i + 1]);
+                    erros = erros + 1;
+                end
+            end
+        end
+        if (uut.evt_level != 0) begin
+            $display("ERRO: %0d eventos na FIFO após a leitura por SPI", uut.evt_level);
+            erros = erros + 1;
+        end
+
+        // CONFIG desliga o registro; CONTROLE zera as estatísticas
+        spi_escrever(7'h05, 32'd0);
+        if (uut.cfg_eventos !== 1'b0) begin
+            $display("ERRO: SPI CONFIG não desligou o registro de eventos");
+            erros = erros + 1;
+        end
+        spi_escrever(7'h05, 32'd1);
+        spi_escrever(7'h06, 32'd1);
+        spi_ler(7'h40, 32);
+        for (i = 0; i < 32; i = i + 1) begin
+            if (spi_buf[i] != 0) begin
+                $display("ERRO: SPI estatística 0x%h = %0d após CONTROLE", 7'h40 + i, spi_buf[i]);
+                erros = erros + 1;
+            end
+        end
+
+        // Sai com código de erro para quem roda o testbench por script
+        if (erros == 0)
+            $display("OK: filtro de glitch, latência, registro de eventos, estatísticas e SPI conferidos");
+        else
+            $fatal(1, "FALHA: %0d erros", erros);
+
         $finish;
     end
 
@@ -1,5 +1,10 @@
 @echo off
 
+if not exist Projeto\impl1\Projeto_impl1.bit (
+    echo Bitstream nao encontrado: rode Sintetiza.bat antes de gravar
+    exit /b 1
+)
+
 cd /d Projeto/impl1
 
 openFPGALoader -b colorlight-i9 --unprotect-flash -f --verify Projeto_impl1.bit
\ No newline at end of file
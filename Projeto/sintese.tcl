@@ -0,0 +1,34 @@
+# ============================================================
+# sintese.tcl
+# ============================================================
+# Refaz a implementação impl1 (síntese, map, PAR e bitstream) pela
+# linha de comando do Diamond e confere o relatório de timing:
+#
+#   pnmainc Projeto/sintese.tcl
+#
+# Sai com erro se o build falhar ou se o .twr tiver erros de timing.
+
+set dir [file dirname [file normalize [info script]]]
+
+prj_project open [file join $dir Projeto.ldf]
+set ok [catch {prj_run Export -impl impl1 -forceAll} msg]
+prj_project close
+
+if {$ok} {
+    puts "ERRO: build do impl1 falhou: $msg"
+    exit 1
+}
+
+set twr [file join $dir impl1 Projeto_impl1.twr]
+set f [open $twr r]
+set relatorio [read $f]
+close $f
+
+if {![regexp {Timing errors: (\d+) \(setup\), (\d+) \(hold\)} $relatorio -> setup hold]} {
+    puts "ERRO: resumo de timing não encontrado em $twr"
+    exit 1
+}
+puts "Timing: $setup erros de setup, $hold de hold"
+if {$setup != 0 || $hold != 0} {
+    exit 1
+}
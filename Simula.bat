@@ -0,0 +1,6 @@
+@echo off
+
+cd /d Arquivos
+
+iverilog -g2012 -Wall -o energy_test Gereciamento_energetico.sv tb_energy_system_all_in_one.sv || exit /b 1
+vvp energy_test
\ No newline at end of file
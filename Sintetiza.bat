@@ -0,0 +1,3 @@
+@echo off
+
+pnmainc Projeto\sintese.tcl
\ No newline at end of file
@@ -0,0 +1,76 @@
+// ===========================================
+// fpga_spi.h
+// ===========================================
+#ifndef FPGA_SPI_H
+#define FPGA_SPI_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// ------------------------------------------------------------
+// Enlace SPI com o FPGA (spi_slave_regs no ECP5)
+// ------------------------------------------------------------
+// O Pico é o mestre (SPI0, modo 0).  Cada transação manda um byte
+// de comando {escrita, endereço[6:0]} e depois palavras de 32 bits
+// MSB primeiro, com incremento automático do endereço.  As rajadas
+// vão por DMA e a tarefa fica bloqueada até o fim, sem gastar CPU.
+// O FPGA amostra SCLK no seu clock de 25 MHz, então SCLK <= clk/8.
+// ------------------------------------------------------------
+#define FPGA_SPI_SCK_PIN        2    // SPI0 SCK  → A2
+#define FPGA_SPI_MOSI_PIN       3    // SPI0 TX   → D1
+#define FPGA_SPI_MISO_PIN       4    // SPI0 RX   ← E1
+#define FPGA_SPI_CS_PIN         1    // CS por software → C2
+
+#define FPGA_SPI_HZ             3000000
+#define FPGA_SPI_MAX_PALAVRAS   32   // palavras por transação
+
+// ==== Mapa de registradores ====
+#define FPGA_REG_ID             0x00
+#define FPGA_REG_STATUS         0x01
+#define FPGA_REG_ENTRADAS       0x02
+#define FPGA_REG_CICLOS         0x03
+#define FPGA_REG_EVT_NIVEL      0x04
+#define FPGA_REG_CONFIG         0x05
+#define FPGA_REG_CONTROLE       0x06
+#define FPGA_REG_SCRATCH        0x07
+#define FPGA_REG_EVT_TS         0x08
+#define FPGA_REG_EVT_INFO       0x09
+#define FPGA_REG_RESIDENCIA(m)  (0x10 | (m))
+#define FPGA_REG_TRANSICAO(a, b) (0x40 | ((a) << 3) | (b))
+
+#define FPGA_ID_ESPERADO        0x454D0001u
+#define FPGA_CLK_HZ             25000000u
+
+// Status rápido devolvido junto com o byte de comando
+#define FPGA_STATUS_EVENTO      0x80  // há evento na FIFO
+#define FPGA_STATUS_FIFO_CHEIA  0x40
+#define FPGA_STATUS_MODO        0x07
+
+#define FPGA_CONFIG_EVENTOS     0x01  // registro de eventos ligado
+#define FPGA_CONTROLE_ZERA      0x01  // zera as estatísticas
+
+// Troca de modo registrada pelo FPGA
+typedef struct {
+    uint32_t ciclo;        // timestamp em ciclos de FPGA_CLK_HZ
+    uint8_t  modo_antigo;
+    uint8_t  modo_novo;
+    uint8_t  entradas;     // {bateria, freio, idle, alta, baixa}
+} fpga_evento_t;
+
+// Configura SPI0, os pinos e os canais de DMA.  Chamar antes do
+// escalonador.
+void fpga_spi_init(void);
+
+// Lê n palavras a partir de reg (n pode ser 0: só o status rápido).
+// status recebe o status rápido se não for NULL.  Bloqueia a tarefa
+// durante a rajada; retorna false em timeout do DMA.
+bool fpga_spi_ler(uint8_t reg, uint32_t *dados, size_t n, uint8_t *status);
+
+bool fpga_spi_escrever(uint8_t reg, uint32_t valor);
+
+// Retira até max eventos da FIFO do FPGA numa única rajada e retorna
+// quantos vieram.
+size_t fpga_spi_ler_eventos(fpga_evento_t *eventos, size_t max);
+
+#endif // FPGA_SPI_H
@@ -0,0 +1,30 @@
+// ===========================================
+// log_serial.h
+// ===========================================
+#ifndef LOG_SERIAL_H
+#define LOG_SERIAL_H
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+// ------------------------------------------------------------
+// Log serial assíncrono
+// ------------------------------------------------------------
+// log_printf() reserva o próximo slot da fila sem bloquear e
+// formata a mensagem direto nele, sem buffer na pilha de quem
+// chama; a LogTask (núcleo 1 no build com USAR_DOIS_NUCLEOS = 1)
+// é a única que escreve no stdio USB.  Assim uma escrita USB lenta
+// nunca atrasa o caminho de controle.  Se a fila estiver cheia, ou
+// outra tarefa estiver formatando no slot reservado, a mensagem é
+// descartada e contada.
+// ------------------------------------------------------------
+#define LOG_LINHA_MAX       96   // bytes por mensagem (com o '\0')
+#define LOG_FILA_TAMANHO    16   // mensagens pendentes
+
+// Cria a fila e a tarefa de log.  Chamar antes de criar as demais
+// tarefas; até lá log_printf() escreve direto no stdio.
+void criar_tarefa_log(UBaseType_t prioridade);
+
+void log_printf(const char *fmt, ...);
+
+#endif // LOG_SERIAL_H
@@ -9,4 +9,15 @@
 // Variável global compartilhada entre tarefas
 extern volatile uint8_t modo_atual;
 
+// No build com dois núcleos o display (escritor) e o buzzer (leitor)
+// podem rodar ao mesmo tempo: acesse o modo só por estas funções, que
+// publicam o byte com barreira de memória entre os núcleos.
+static inline void modo_publicar(uint8_t modo) {
+    __atomic_store_n(&modo_atual, modo, __ATOMIC_RELEASE);
+}
+
+static inline uint8_t modo_ler(void) {
+    return __atomic_load_n(&modo_atual, __ATOMIC_ACQUIRE);
+}
+
 #endif
@@ -0,0 +1,79 @@
+// ===========================================
+// tarefas_estaticas.h
+// ===========================================
+#ifndef TAREFAS_ESTATICAS_H
+#define TAREFAS_ESTATICAS_H
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "rp2040_banks.h"
+
+// ============================================================
+// ORÇAMENTO DE PILHA DAS TAREFAS (em palavras de StackType_t)
+// ------------------------------------------------------------
+// X(id, nome, pilha, banco, nucleo)
+//  - pilha:  tamanho da pilha em palavras (4 bytes no RP2040)
+//  - banco:  STRIPED      -> pilha e TCB em buffers estáticos (.bss)
+//            SCRATCH_X/Y  -> pilha e TCB nas arenas dos bancos
+//                            SRAM4/SRAM5 (ver rp2040_banks.h).  O
+//                            banco tem que ser o do núcleo da tarefa
+//                            (Y no 0, X no 1); tarefas_estaticas.c
+//                            não compila se não for.
+//  - nucleo: CONTROLE     -> núcleo 0 (decisões enviadas ao FPGA)
+//            UI           -> núcleo 1 (I2C, PWM e USB, que bloqueiam)
+//            Só tem efeito no build com USAR_DOIS_NUCLEOS = 1.
+//
+// Para refazer a tabela, compile com MEDIR_PILHAS = 1, deixe o
+// sistema rodar por MEDIR_PILHAS_SOAK_MS e copie a tabela
+// impressa na serial para cá.
+// ============================================================
+#define TABELA_TAREFAS(X)                                                \
+    X(TAREFA_JOYSTICK,     "JoystickTask", 512, STRIPED,   CONTROLE)     \
+    X(TAREFA_FREIO,        "FreioTask",    256, SCRATCH_Y, CONTROLE)     \
+    X(TAREFA_BATERIA,      "BatteryTask",  256, STRIPED,   CONTROLE)     \
+    X(TAREFA_FPGA_MONITOR, "FPGA_Monitor", 256, STRIPED,   CONTROLE)     \
+    X(TAREFA_DISPLAY,      "DisplayTask",  512, STRIPED,   UI)           \
+    X(TAREFA_BUZZER,       "BuzzerTask",   256, SCRATCH_X, UI)           \
+    X(TAREFA_LOG,          "LogTask",      512, STRIPED,   UI)
+
+#define NUCLEO_CONTROLE     0
+#define NUCLEO_UI           1
+
+#define TAREFA_ENUM(id, nome, pilha, banco, nucleo) id,
+
+typedef enum {
+    TABELA_TAREFAS(TAREFA_ENUM)
+    NUM_TAREFAS
+} tarefa_id_t;
+
+// ============================================================
+// MODO DE MEDIÇÃO DE PILHA
+// ------------------------------------------------------------
+// Com MEDIR_PILHAS = 1, uma tarefa extra espera MEDIR_PILHAS_SOAK_MS,
+// lê uxTaskGetStackHighWaterMark() de cada tarefa e imprime uma
+// TABELA_TAREFAS nova, com MEDIR_PILHAS_MARGEM_PCT de folga sobre o
+// maior uso observado.  Durante a medição, use um orçamento folgado.
+// Fora dela, configCHECK_FOR_STACK_OVERFLOW = 2 para o sistema em
+// vApplicationStackOverflowHook() se um orçamento ficar curto.
+// ============================================================
+#ifndef MEDIR_PILHAS
+#define MEDIR_PILHAS              0
+#endif
+
+#ifndef MEDIR_PILHAS_SOAK_MS
+#define MEDIR_PILHAS_SOAK_MS      (10 * 60 * 1000)
+#endif
+
+#ifndef MEDIR_PILHAS_MARGEM_PCT
+#define MEDIR_PILHAS_MARGEM_PCT   25
+#endif
+
+// Cria a tarefa 'id' sem alocação dinâmica, usando a pilha e o banco
+// definidos em TABELA_TAREFAS.  Retorna o handle (NULL em caso de falha).
+TaskHandle_t criar_tarefa_estatica(tarefa_id_t id, TaskFunction_t funcao,
+                                   void *params, UBaseType_t prioridade);
+
+// Cria a tarefa de medição de pilha (não faz nada com MEDIR_PILHAS = 0).
+void iniciar_medicao_pilhas(void);
+
+#endif // TAREFAS_ESTATICAS_H
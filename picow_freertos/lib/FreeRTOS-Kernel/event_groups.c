@@ -56,6 +56,11 @@
         EventBits_t uxEventBits;
         List_t xTasksWaitingForBits; /**< List of tasks waiting for a bit to be set. */
 
+        #if ( configUSE_EVENT_GROUP_DIRECT_ISR_SET == 1 )
+            UBaseType_t uxTaskLock;    /**< Non-zero while a task accesses xTasksWaitingForBits with the scheduler suspended. */
+            UBaseType_t uxPendedCalls; /**< Requests from interrupts pended to the timer task that have not run yet. */
+        #endif
+
         #if ( configUSE_TRACE_FACILITY == 1 )
             UBaseType_t uxEventGroupNumber;
         #endif
@@ -79,6 +84,63 @@
                                             const EventBits_t uxBitsToWaitFor,
                                             const BaseType_t xWaitForAllBits ) PRIVILEGED_FUNCTION;
 
+/*
+ * xEventGroupSetBitsFromISR() can set bits and unblock tasks directly, from a
+ * critical section.  Tasks access xTasksWaitingForBits with the scheduler
+ * suspended, which does not stop interrupts, so they lock the event group
+ * while doing so, and an interrupt that finds the event group locked pends
+ * the request to the timer task as before.
+ */
+    #if ( configUSE_EVENT_GROUP_DIRECT_ISR_SET == 1 )
+
+        #define prvLockEventGroup( pxEventBits ) \
+    taskENTER_CRITICAL();                        \
+    {                                            \
+        ( pxEventBits )->uxTaskLock++;           \
+    }                                            \
+    taskEXIT_CRITICAL()
+
+        #define prvUnlockEventGroup( pxEventBits ) \
+    taskENTER_CRITICAL();                          \
+    {                                              \
+        ( pxEventBits )->uxTaskLock--;             \
+    }                                              \
+    taskEXIT_CRITICAL()
+
+/*
+ * Sets bits and unblocks the waiting tasks without leaving the interrupt if no
+ * more than configEVENT_GROUP_ISR_MAX_WAITERS tasks are waiting and no more
+ * than configEVENT_GROUP_ISR_MAX_WAKES of them are unblocked, so the time spent
+ * in the interrupt does not grow with the number of waiters.  Otherwise the
+ * whole request is pended to the timer task.
+ */
+        static BaseType_t prvSetBitsFromISR( EventGroup_t * pxEventBits,
+                                             const EventBits_t uxBitsToSet,
+                                             BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Pends xFunctionToPend to the timer task.  The caller must already have
+ * counted the call in uxPendedCalls, which is undone if the timer queue is
+ * full.  While any call is pending, later requests from interrupts are pended
+ * too so they cannot overtake it.
+ */
+        static BaseType_t prvPendCallFromISR( PendedFunction_t xFunctionToPend,
+                                              EventGroup_t * pxEventBits,
+                                              uint32_t ulParameter,
+                                              BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by the timer task once a pended call has run.
+ */
+        static void prvPendedCallComplete( EventGroup_t * pxEventBits ) PRIVILEGED_FUNCTION;
+
+    #else /* configUSE_EVENT_GROUP_DIRECT_ISR_SET */
+
+        #define prvLockEventGroup( pxEventBits )
+        #define prvUnlockEventGroup( pxEventBits )
+
+    #endif /* configUSE_EVENT_GROUP_DIRECT_ISR_SET */
+
 /*-----------------------------------------------------------*/
 
     #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
@@ -113,6 +175,13 @@
                 pxEventBits->uxEventBits = 0;
                 vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
 
+                #if ( configUSE_EVENT_GROUP_DIRECT_ISR_SET == 1 )
+                {
+                    pxEventBits->uxTaskLock = 0U;
+                    pxEventBits->uxPendedCalls = 0U;
+                }
+                #endif
+
                 #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
                 {
                     /* Both static and dynamic allocation can be used, so note that
@@ -158,6 +227,13 @@
                 pxEventBits->uxEventBits = 0;
                 vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
 
+                #if ( configUSE_EVENT_GROUP_DIRECT_ISR_SET == 1 )
+                {
+                    pxEventBits->uxTaskLock = 0U;
+                    pxEventBits->uxPendedCalls = 0U;
+                }
+                #endif
+
                 #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
                 {
                     /* Both static and dynamic allocation can be used, so note this
@@ -204,6 +280,8 @@
 
         vTaskSuspendAll();
         {
+            prvLockEventGroup( pxEventBits );
+
             uxOriginalBitValue = pxEventBits->uxEventBits;
 
             ( void ) xEventGroupSetBits( xEventGroup, uxBitsToSet );
@@ -244,6 +322,8 @@
                     xTimeoutOccurred = pdTRUE;
                 }
             }
+
+            prvUnlockEventGroup( pxEventBits );
         }
         xAlreadyYielded = xTaskResumeAll();
 
@@ -335,7 +415,13 @@
 
         vTaskSuspendAll();
         {
-            const EventBits_t uxCurrentEventBits = pxEventBits->uxEventBits;
+            EventBits_t uxCurrentEventBits;
+
+            /* Lock before reading the bits, so an interrupt cannot set them
+             * directly between the test and the task blocking. */
+            prvLockEventGroup( pxEventBits );
+
+            uxCurrentEventBits = pxEventBits->uxEventBits;
 
             /* Check to see if the wait condition is already met or not. */
             xWaitConditionMet = prvTestWaitCondition( uxCurrentEventBits, uxBitsToWaitFor, xWaitForAllBits );
@@ -400,6 +486,8 @@
 
                 traceEVENT_GROUP_WAIT_BITS_BLOCK( xEventGroup, uxBitsToWaitFor );
             }
+
+            prvUnlockEventGroup( pxEventBits );
         }
         xAlreadyYielded = xTaskResumeAll();
 
@@ -501,7 +589,7 @@
     }
 /*-----------------------------------------------------------*/
 
-    #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+    #if ( ( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_EVENT_GROUP_DIRECT_ISR_SET == 1 ) ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
 
         BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup,
                                                 const EventBits_t uxBitsToClear )
@@ -511,14 +599,36 @@
             traceENTER_xEventGroupClearBitsFromISR( xEventGroup, uxBitsToClear );
 
             traceEVENT_GROUP_CLEAR_BITS_FROM_ISR( xEventGroup, uxBitsToClear );
-            xReturn = xTimerPendFunctionCallFromISR( vEventGroupClearBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToClear, NULL );
+
+            #if ( configUSE_EVENT_GROUP_DIRECT_ISR_SET == 1 )
+            {
+                EventGroup_t * pxEventBits = xEventGroup;
+                UBaseType_t uxSavedInterruptStatus;
+
+                configASSERT( pxEventBits );
+
+                /* Clearing is still pended, but is counted so that a later
+                 * direct set cannot overtake it. */
+                uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+                {
+                    pxEventBits->uxPendedCalls++;
+                }
+                taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+                xReturn = prvPendCallFromISR( vEventGroupClearBitsCallback, pxEventBits, ( uint32_t ) uxBitsToClear, NULL );
+            }
+            #else
+            {
+                xReturn = xTimerPendFunctionCallFromISR( vEventGroupClearBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToClear, NULL );
+            }
+            #endif /* configUSE_EVENT_GROUP_DIRECT_ISR_SET */
 
             traceRETURN_xEventGroupClearBitsFromISR( xReturn );
 
             return xReturn;
         }
 
-    #endif /* if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) ) */
+    #endif /* if ( ( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_EVENT_GROUP_DIRECT_ISR_SET == 1 ) ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) ) */
 /*-----------------------------------------------------------*/
 
     EventBits_t xEventGroupGetBitsFromISR( EventGroupHandle_t xEventGroup )
@@ -568,6 +678,8 @@
         {
             traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet );
 
+            prvLockEventGroup( pxEventBits );
+
             pxListItem = listGET_HEAD_ENTRY( pxList );
 
             /* Set the bits. */
@@ -638,6 +750,8 @@
 
             /* Snapshot resulting bits. */
             uxReturnBits = pxEventBits->uxEventBits;
+
+            prvUnlockEventGroup( pxEventBits );
         }
         ( void ) xTaskResumeAll();
 
@@ -662,6 +776,8 @@
         {
             traceEVENT_GROUP_DELETE( xEventGroup );
 
+            prvLockEventGroup( pxEventBits );
+
             while( listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0 )
             {
                 /* Unblock the task, returning 0 as the event list is being deleted
@@ -669,6 +785,8 @@
                 configASSERT( pxTasksWaitingForBits->xListEnd.pxNext != ( const ListItem_t * ) &( pxTasksWaitingForBits->xListEnd ) );
                 vTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
             }
+
+            prvUnlockEventGroup( pxEventBits );
         }
         ( void ) xTaskResumeAll();
 
@@ -755,6 +873,15 @@
         /* coverity[misra_c_2012_rule_11_5_violation] */
         ( void ) xEventGroupSetBits( pvEventGroup, ( EventBits_t ) ulBitsToSet );
 
+        #if ( configUSE_EVENT_GROUP_DIRECT_ISR_SET == 1 )
+        {
+            /* MISRA Ref 11.5.4 [Callback function parameter] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            prvPendedCallComplete( ( EventGroup_t * ) pvEventGroup );
+        }
+        #endif
+
         traceRETURN_vEventGroupSetBitsCallback();
     }
 /*-----------------------------------------------------------*/
@@ -771,6 +898,15 @@
         /* coverity[misra_c_2012_rule_11_5_violation] */
         ( void ) xEventGroupClearBits( pvEventGroup, ( EventBits_t ) ulBitsToClear );
 
+        #if ( configUSE_EVENT_GROUP_DIRECT_ISR_SET == 1 )
+        {
+            /* MISRA Ref 11.5.4 [Callback function parameter] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            prvPendedCallComplete( ( EventGroup_t * ) pvEventGroup );
+        }
+        #endif
+
         traceRETURN_vEventGroupClearBitsCallback();
     }
 /*-----------------------------------------------------------*/
@@ -812,7 +948,7 @@
     }
 /*-----------------------------------------------------------*/
 
-    #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+    #if ( ( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_EVENT_GROUP_DIRECT_ISR_SET == 1 ) ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
 
         BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup,
                                               const EventBits_t uxBitsToSet,
@@ -823,14 +959,205 @@
             traceENTER_xEventGroupSetBitsFromISR( xEventGroup, uxBitsToSet, pxHigherPriorityTaskWoken );
 
             traceEVENT_GROUP_SET_BITS_FROM_ISR( xEventGroup, uxBitsToSet );
-            xReturn = xTimerPendFunctionCallFromISR( vEventGroupSetBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToSet, pxHigherPriorityTaskWoken );
+
+            #if ( configUSE_EVENT_GROUP_DIRECT_ISR_SET == 1 )
+            {
+                xReturn = prvSetBitsFromISR( xEventGroup, uxBitsToSet, pxHigherPriorityTaskWoken );
+            }
+            #else
+            {
+                xReturn = xTimerPendFunctionCallFromISR( vEventGroupSetBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToSet, pxHigherPriorityTaskWoken );
+            }
+            #endif /* configUSE_EVENT_GROUP_DIRECT_ISR_SET */
 
             traceRETURN_xEventGroupSetBitsFromISR( xReturn );
 
             return xReturn;
         }
 
-    #endif /* if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) ) */
+    #endif /* if ( ( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_EVENT_GROUP_DIRECT_ISR_SET == 1 ) ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_EVENT_GROUP_DIRECT_ISR_SET == 1 )
+
+        static BaseType_t prvSetBitsFromISR( EventGroup_t * pxEventBits,
+                                             const EventBits_t uxBitsToSet,
+                                             BaseType_t * pxHigherPriorityTaskWoken )
+        {
+            ListItem_t * pxListItem;
+            ListItem_t * pxNext;
+            ListItem_t const * pxListEnd;
+            EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits, uxNewEventBits;
+            EventBits_t uxBitsToPend = 0;
+            UBaseType_t uxSavedInterruptStatus, uxTasksToUnblock = 0U;
+            BaseType_t xWaitForAllBits, xPend = pdFALSE, xReturn = pdPASS;
+
+            configASSERT( pxEventBits );
+            configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+
+            pxListEnd = listGET_END_MARKER( &( pxEventBits->xTasksWaitingForBits ) );
+
+            uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+            {
+                if( ( pxEventBits->uxTaskLock == ( UBaseType_t ) 0U ) &&
+                    ( pxEventBits->uxPendedCalls == ( UBaseType_t ) 0U ) &&
+                    ( listCURRENT_LIST_LENGTH( &( pxEventBits->xTasksWaitingForBits ) ) <= ( UBaseType_t ) configEVENT_GROUP_ISR_MAX_WAITERS ) )
+                {
+                    /* No task is using the waiting list, no earlier request is
+                     * still queued for the timer task, and the list is short
+                     * enough to walk here.  Bound the time spent in the interrupt
+                     * by first counting the waiters the new bits would release,
+                     * without changing anything. */
+                    uxNewEventBits = pxEventBits->uxEventBits | uxBitsToSet;
+
+                    for( pxListItem = listGET_HEAD_ENTRY( &( pxEventBits->xTasksWaitingForBits ) ); pxListItem != pxListEnd; pxListItem = listGET_NEXT( pxListItem ) )
+                    {
+                        uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
+                        xWaitForAllBits = ( ( uxBitsWaitedFor & eventWAIT_FOR_ALL_BITS ) != ( EventBits_t ) 0 ) ? pdTRUE : pdFALSE;
+
+                        if( prvTestWaitCondition( uxNewEventBits, uxBitsWaitedFor & ~eventEVENT_BITS_CONTROL_BYTES, xWaitForAllBits ) != pdFALSE )
+                        {
+                            uxTasksToUnblock++;
+
+                            if( uxTasksToUnblock > ( UBaseType_t ) configEVENT_GROUP_ISR_MAX_WAKES )
+                            {
+                                xPend = pdTRUE;
+                                break;
+                            }
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+
+                    if( xPend == pdFALSE )
+                    {
+                        /* Within the limit, so set the bits and unblock the tasks
+                         * here exactly as xEventGroupSetBits() would. */
+                        pxEventBits->uxEventBits = uxNewEventBits;
+
+                        pxListItem = listGET_HEAD_ENTRY( &( pxEventBits->xTasksWaitingForBits ) );
+
+                        while( pxListItem != pxListEnd )
+                        {
+                            pxNext = listGET_NEXT( pxListItem );
+                            uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
+
+                            /* Split the bits waited for from the control bits. */
+                            uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
+                            uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+                            xWaitForAllBits = ( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) != ( EventBits_t ) 0 ) ? pdTRUE : pdFALSE;
+
+                            if( prvTestWaitCondition( pxEventBits->uxEventBits, uxBitsWaitedFor, xWaitForAllBits ) != pdFALSE )
+                            {
+                                if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
+                                {
+                                    uxBitsToClear |= uxBitsWaitedFor;
+                                }
+                                else
+                                {
+                                    mtCOVERAGE_TEST_MARKER();
+                                }
+
+                                if( xTaskRemoveFromUnorderedEventListFromISR( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET ) != pdFALSE )
+                                {
+                                    if( pxHigherPriorityTaskWoken != NULL )
+                                    {
+                                        *pxHigherPriorityTaskWoken = pdTRUE;
+                                    }
+                                    else
+                                    {
+                                        mtCOVERAGE_TEST_MARKER();
+                                    }
+                                }
+                                else
+                                {
+                                    mtCOVERAGE_TEST_MARKER();
+                                }
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+
+                            pxListItem = pxNext;
+                        }
+
+                        pxEventBits->uxEventBits &= ~uxBitsToClear;
+                    }
+                    else
+                    {
+                        /* Too many tasks to unblock from the interrupt.  Nothing
+                         * has been changed yet, so the timer task can do the
+                         * whole request. */
+                        uxBitsToPend = uxBitsToSet;
+                        pxEventBits->uxPendedCalls++;
+                    }
+                }
+                else
+                {
+                    /* Leave the whole request to the timer task, which may walk a
+                     * list of any length. */
+                    uxBitsToPend = uxBitsToSet;
+                    xPend = pdTRUE;
+                    pxEventBits->uxPendedCalls++;
+                }
+            }
+            taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+            if( xPend != pdFALSE )
+            {
+                xReturn = prvPendCallFromISR( vEventGroupSetBitsCallback, pxEventBits, ( uint32_t ) uxBitsToPend, pxHigherPriorityTaskWoken );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            return xReturn;
+        }
+/*-----------------------------------------------------------*/
+
+        static BaseType_t prvPendCallFromISR( PendedFunction_t xFunctionToPend,
+                                              EventGroup_t * pxEventBits,
+                                              uint32_t ulParameter,
+                                              BaseType_t * pxHigherPriorityTaskWoken )
+        {
+            BaseType_t xReturn;
+            UBaseType_t uxSavedInterruptStatus;
+
+            xReturn = xTimerPendFunctionCallFromISR( xFunctionToPend, ( void * ) pxEventBits, ulParameter, pxHigherPriorityTaskWoken );
+
+            if( xReturn != pdPASS )
+            {
+                /* The call will never run, so stop later requests waiting for it. */
+                uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+                {
+                    pxEventBits->uxPendedCalls--;
+                }
+                taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            return xReturn;
+        }
+/*-----------------------------------------------------------*/
+
+        static void prvPendedCallComplete( EventGroup_t * pxEventBits )
+        {
+            taskENTER_CRITICAL();
+            {
+                configASSERT( pxEventBits->uxPendedCalls > ( UBaseType_t ) 0U );
+                pxEventBits->uxPendedCalls--;
+            }
+            taskEXIT_CRITICAL();
+        }
+
+    #endif /* configUSE_EVENT_GROUP_DIRECT_ISR_SET */
 /*-----------------------------------------------------------*/
 
     #if ( configUSE_TRACE_FACILITY == 1 )
@@ -321,6 +321,14 @@
     #define configUSE_MUTEXES    0
 #endif
 
+#ifndef configMUTEX_SPIN_ITERATIONS
+    #define configMUTEX_SPIN_ITERATIONS    0
+#endif
+
+#if ( ( configMUTEX_SPIN_ITERATIONS > 0 ) && ( configNUMBER_OF_CORES > 1 ) && ( INCLUDE_xTaskGetCurrentTaskHandle != 1 ) && ( configUSE_RECURSIVE_MUTEXES != 1 ) )
+    #error configMUTEX_SPIN_ITERATIONS requires INCLUDE_xTaskGetCurrentTaskHandle or configUSE_RECURSIVE_MUTEXES to be set to 1
+#endif
+
 #ifndef configUSE_TIMERS
     #define configUSE_TIMERS    0
 #endif
@@ -333,6 +341,26 @@
     #define configUSE_STREAM_BUFFERS    1
 #endif
 
+#ifndef configUSE_MEMORY_POOLS
+    #define configUSE_MEMORY_POOLS    0
+#endif
+
+#ifndef configMEMORY_POOL_MAX_SIZE_CLASSES
+    #define configMEMORY_POOL_MAX_SIZE_CLASSES    4
+#endif
+
+#ifndef configKERNEL_OBJECTS_FROM_MEMORY_POOLS
+    #define configKERNEL_OBJECTS_FROM_MEMORY_POOLS    0
+#endif
+
+#if ( ( configKERNEL_OBJECTS_FROM_MEMORY_POOLS == 1 ) && ( configUSE_MEMORY_POOLS != 1 ) )
+    #error configKERNEL_OBJECTS_FROM_MEMORY_POOLS requires configUSE_MEMORY_POOLS to be set to 1
+#endif
+
+#ifndef configUSE_SPSC_RINGS
+    #define configUSE_SPSC_RINGS    0
+#endif
+
 #ifndef configUSE_DAEMON_TASK_STARTUP_HOOK
     #define configUSE_DAEMON_TASK_STARTUP_HOOK    0
 #endif
@@ -398,6 +426,13 @@
     #define portMEMORY_BARRIER()
 #endif
 
+/* portDATA_MEMORY_BARRIER() orders memory accesses as seen by other cores and
+ * bus masters, not just by the compiler.  Ports where the hardware can reorder
+ * or delay accesses between cores must define it. */
+#ifndef portDATA_MEMORY_BARRIER
+    #define portDATA_MEMORY_BARRIER()    portMEMORY_BARRIER()
+#endif
+
 #ifndef portSOFTWARE_BARRIER
     #define portSOFTWARE_BARRIER()
 #endif
@@ -531,6 +566,37 @@
         #define portTIMER_CALLBACK_ATTRIBUTE
     #endif /* portTIMER_CALLBACK_ATTRIBUTE */
 
+/* Set configUSE_TIMER_WHEEL to 1 to hold active timers in a hierarchical timing
+ * wheel instead of two sorted lists, making start, stop and expiry O(1). */
+    #ifndef configUSE_TIMER_WHEEL
+        #define configUSE_TIMER_WHEEL    0
+    #endif
+
+    #if ( configUSE_TIMER_WHEEL == 1 )
+
+/* Each level of the wheel has ( 1 << configTIMER_WHEEL_SLOT_BITS ) slots, each
+ * slot covering ( 1 << ( configTIMER_WHEEL_SLOT_BITS * level ) ) ticks.  Timers
+ * further in the future than the top level can reach are re-filed when the top
+ * level wraps. */
+        #ifndef configTIMER_WHEEL_SLOT_BITS
+            #define configTIMER_WHEEL_SLOT_BITS    4
+        #endif
+
+        #ifndef configTIMER_WHEEL_LEVELS
+            #define configTIMER_WHEEL_LEVELS    4
+        #endif
+
+        #if ( ( configTIMER_WHEEL_SLOT_BITS < 1 ) || ( configTIMER_WHEEL_SLOT_BITS > 5 ) )
+            #error configTIMER_WHEEL_SLOT_BITS must be between 1 and 5.
+        #endif
+
+/* Timers due beyond the wheel's reach are parked in the top level and re-filed
+ * when that level cascades, which level 0 never does. */
+        #if ( configTIMER_WHEEL_LEVELS < 2 )
+            #error configTIMER_WHEEL_LEVELS must be at least 2.
+        #endif
+    #endif /* configUSE_TIMER_WHEEL */
+
 #endif /* configUSE_TIMERS */
 
 #ifndef portHAS_NESTED_INTERRUPTS
@@ -1476,6 +1542,54 @@
     #define traceRETURN_vQueueWaitForMessageRestricted()
 #endif
 
+#ifndef traceENTER_xQueueReserve
+    #define traceENTER_xQueueReserve( xQueue, ppvSlot, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueueReserve
+    #define traceRETURN_xQueueReserve( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueCommit
+    #define traceENTER_xQueueCommit( xQueue, pvSlot )
+#endif
+
+#ifndef traceRETURN_xQueueCommit
+    #define traceRETURN_xQueueCommit( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueAcquire
+    #define traceENTER_xQueueAcquire( xQueue, ppvItem, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueueAcquire
+    #define traceRETURN_xQueueAcquire( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueRelease
+    #define traceENTER_xQueueRelease( xQueue, pvItem )
+#endif
+
+#ifndef traceRETURN_xQueueRelease
+    #define traceRETURN_xQueueRelease( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueSendMultiple
+    #define traceENTER_xQueueSendMultiple( xQueue, pvItems, uxItemCount, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueueSendMultiple
+    #define traceRETURN_xQueueSendMultiple( uxItemsSent )
+#endif
+
+#ifndef traceENTER_xQueueReceiveMultiple
+    #define traceENTER_xQueueReceiveMultiple( xQueue, pvBuffer, uxMaxItems, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueueReceiveMultiple
+    #define traceRETURN_xQueueReceiveMultiple( uxItemsReceived )
+#endif
+
 #ifndef traceENTER_xQueueCreateSet
     #define traceENTER_xQueueCreateSet( uxEventQueueLength )
 #endif
@@ -2096,6 +2210,38 @@
     #define traceRETURN_vTaskRemoveFromUnorderedEventList()
 #endif
 
+#ifndef traceENTER_xTaskRemoveFromUnorderedEventListFromISR
+    #define traceENTER_xTaskRemoveFromUnorderedEventListFromISR( pxEventListItem, xItemValue )
+#endif
+
+#ifndef traceRETURN_xTaskRemoveFromUnorderedEventListFromISR
+    #define traceRETURN_xTaskRemoveFromUnorderedEventListFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_vTaskSetQueueHandOffBuffer
+    #define traceENTER_vTaskSetQueueHandOffBuffer( pvBuffer )
+#endif
+
+#ifndef traceRETURN_vTaskSetQueueHandOffBuffer
+    #define traceRETURN_vTaskSetQueueHandOffBuffer()
+#endif
+
+#ifndef traceENTER_pvTaskTakeQueueHandOffBuffer
+    #define traceENTER_pvTaskTakeQueueHandOffBuffer( pxEventList )
+#endif
+
+#ifndef traceRETURN_pvTaskTakeQueueHandOffBuffer
+    #define traceRETURN_pvTaskTakeQueueHandOffBuffer( pvBuffer )
+#endif
+
+#ifndef traceENTER_xTaskResetQueueHandOffBuffer
+    #define traceENTER_xTaskResetQueueHandOffBuffer()
+#endif
+
+#ifndef traceRETURN_xTaskResetQueueHandOffBuffer
+    #define traceRETURN_xTaskResetQueueHandOffBuffer( xReturn )
+#endif
+
 #ifndef traceENTER_vTaskSetTimeOutState
     #define traceENTER_vTaskSetTimeOutState( pxTimeOut )
 #endif
@@ -2592,6 +2738,54 @@
     #define traceRETURN_vStreamBufferSetStreamBufferNumber()
 #endif
 
+#ifndef traceENTER_xStreamBufferGetWriteWindow
+    #define traceENTER_xStreamBufferGetWriteWindow( xStreamBuffer, pxWindow, xMinimumBytes, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xStreamBufferGetWriteWindow
+    #define traceRETURN_xStreamBufferGetWriteWindow( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferCommitWrite
+    #define traceENTER_xStreamBufferCommitWrite( xStreamBuffer, xBytesWritten )
+#endif
+
+#ifndef traceRETURN_xStreamBufferCommitWrite
+    #define traceRETURN_xStreamBufferCommitWrite( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferCommitWriteFromISR
+    #define traceENTER_xStreamBufferCommitWriteFromISR( xStreamBuffer, xBytesWritten, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xStreamBufferCommitWriteFromISR
+    #define traceRETURN_xStreamBufferCommitWriteFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferGetReadWindow
+    #define traceENTER_xStreamBufferGetReadWindow( xStreamBuffer, pxWindow, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xStreamBufferGetReadWindow
+    #define traceRETURN_xStreamBufferGetReadWindow( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferCommitRead
+    #define traceENTER_xStreamBufferCommitRead( xStreamBuffer, xBytesRead )
+#endif
+
+#ifndef traceRETURN_xStreamBufferCommitRead
+    #define traceRETURN_xStreamBufferCommitRead( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferCommitReadFromISR
+    #define traceENTER_xStreamBufferCommitReadFromISR( xStreamBuffer, xBytesRead, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xStreamBufferCommitReadFromISR
+    #define traceRETURN_xStreamBufferCommitReadFromISR( xReturn )
+#endif
+
 #ifndef traceENTER_ucStreamBufferGetStreamBufferType
     #define traceENTER_ucStreamBufferGetStreamBufferType( xStreamBuffer )
 #endif
@@ -2672,6 +2866,110 @@
     #define traceRETURN_xCoRoutineRemoveFromEventList( xReturn )
 #endif
 
+#ifndef traceENTER_xMemoryPoolCreateStatic
+    #define traceENTER_xMemoryPoolCreateStatic( xBlockSize, uxBlockCount, pucPoolStorageBuffer, pxStaticMemoryPool )
+#endif
+
+#ifndef traceRETURN_xMemoryPoolCreateStatic
+    #define traceRETURN_xMemoryPoolCreateStatic( xMemoryPool )
+#endif
+
+#ifndef traceENTER_pvMemoryPoolAlloc
+    #define traceENTER_pvMemoryPoolAlloc( xMemoryPool )
+#endif
+
+#ifndef traceRETURN_pvMemoryPoolAlloc
+    #define traceRETURN_pvMemoryPoolAlloc( pvReturn )
+#endif
+
+#ifndef traceENTER_vMemoryPoolFree
+    #define traceENTER_vMemoryPoolFree( xMemoryPool, pvBlock )
+#endif
+
+#ifndef traceRETURN_vMemoryPoolFree
+    #define traceRETURN_vMemoryPoolFree()
+#endif
+
+#ifndef traceENTER_xMemoryPoolAddSizeClass
+    #define traceENTER_xMemoryPoolAddSizeClass( xMemoryPool )
+#endif
+
+#ifndef traceRETURN_xMemoryPoolAddSizeClass
+    #define traceRETURN_xMemoryPoolAddSizeClass( xReturn )
+#endif
+
+#ifndef traceENTER_pvMemoryPoolAllocFromSizeClass
+    #define traceENTER_pvMemoryPoolAllocFromSizeClass( xWantedSize )
+#endif
+
+#ifndef traceRETURN_pvMemoryPoolAllocFromSizeClass
+    #define traceRETURN_pvMemoryPoolAllocFromSizeClass( pvReturn )
+#endif
+
+#ifndef traceENTER_xMemoryPoolFreeToSizeClass
+    #define traceENTER_xMemoryPoolFreeToSizeClass( pvBlock )
+#endif
+
+#ifndef traceRETURN_xMemoryPoolFreeToSizeClass
+    #define traceRETURN_xMemoryPoolFreeToSizeClass( xReturn )
+#endif
+
+#ifndef traceENTER_xSpscRingCreateStatic
+    #define traceENTER_xSpscRingCreateStatic( xItemSize, uxLength, pucRingStorageBuffer, pxStaticRing )
+#endif
+
+#ifndef traceRETURN_xSpscRingCreateStatic
+    #define traceRETURN_xSpscRingCreateStatic( xRing )
+#endif
+
+#ifndef traceENTER_vSpscRingSetConsumerTask
+    #define traceENTER_vSpscRingSetConsumerTask( xRing, xTaskToNotify, uxIndexToNotify )
+#endif
+
+#ifndef traceRETURN_vSpscRingSetConsumerTask
+    #define traceRETURN_vSpscRingSetConsumerTask()
+#endif
+
+#ifndef traceENTER_xSpscRingPush
+    #define traceENTER_xSpscRingPush( xRing, pvItem )
+#endif
+
+#ifndef traceRETURN_xSpscRingPush
+    #define traceRETURN_xSpscRingPush( xReturn )
+#endif
+
+#ifndef traceENTER_xSpscRingPushFromISR
+    #define traceENTER_xSpscRingPushFromISR( xRing, pvItem, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xSpscRingPushFromISR
+    #define traceRETURN_xSpscRingPushFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xSpscRingPop
+    #define traceENTER_xSpscRingPop( xRing, pvBuffer )
+#endif
+
+#ifndef traceRETURN_xSpscRingPop
+    #define traceRETURN_xSpscRingPop( xReturn )
+#endif
+
+#ifndef traceENTER_xSpscRingReceive
+    #define traceENTER_xSpscRingReceive( xRing, pvBuffer, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xSpscRingReceive
+    #define traceRETURN_xSpscRingReceive( xReturn )
+#endif
+
+#ifndef traceENTER_uxSpscRingItemsWaiting
+    #define traceENTER_uxSpscRingItemsWaiting( xRing )
+#endif
+
+#ifndef traceRETURN_uxSpscRingItemsWaiting
+    #define traceRETURN_uxSpscRingItemsWaiting( uxReturn )
+#endif
+
 #ifndef configGENERATE_RUN_TIME_STATS
     #define configGENERATE_RUN_TIME_STATS    0
 #endif
@@ -2734,6 +3032,52 @@
     #define configUSE_QUEUE_SETS    0
 #endif
 
+#ifndef configUSE_QUEUE_ZERO_COPY
+    #define configUSE_QUEUE_ZERO_COPY    0
+#endif
+
+#if ( ( configUSE_QUEUE_ZERO_COPY == 1 ) && ( INCLUDE_xTaskGetCurrentTaskHandle != 1 ) && ( configUSE_RECURSIVE_MUTEXES != 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+    #error configUSE_QUEUE_ZERO_COPY requires INCLUDE_xTaskGetCurrentTaskHandle or configUSE_RECURSIVE_MUTEXES to be set to 1
+#endif
+
+#ifndef configUSE_QUEUE_HAND_OFF
+    #define configUSE_QUEUE_HAND_OFF    0
+#endif
+
+#ifndef configUSE_QUEUE_MULTIPLE_ITEMS
+    #define configUSE_QUEUE_MULTIPLE_ITEMS    0
+#endif
+
+#ifndef configUSE_STREAM_BUFFER_ZERO_COPY
+    #define configUSE_STREAM_BUFFER_ZERO_COPY    0
+#endif
+
+#ifndef configUSE_EVENT_GROUP_DIRECT_ISR_SET
+    #define configUSE_EVENT_GROUP_DIRECT_ISR_SET    0
+#endif
+
+#ifndef configEVENT_GROUP_ISR_MAX_WAKES
+    #define configEVENT_GROUP_ISR_MAX_WAKES    4
+#endif
+
+#ifndef configEVENT_GROUP_ISR_MAX_WAITERS
+    #define configEVENT_GROUP_ISR_MAX_WAITERS    16
+#endif
+
+#if ( configUSE_EVENT_GROUP_DIRECT_ISR_SET == 1 )
+    #if ( ( configUSE_TIMERS != 1 ) || ( INCLUDE_xTimerPendFunctionCall != 1 ) )
+        #error configUSE_EVENT_GROUP_DIRECT_ISR_SET requires configUSE_TIMERS and INCLUDE_xTimerPendFunctionCall to be set to 1
+    #endif
+
+    #if ( configEVENT_GROUP_ISR_MAX_WAKES < 1 )
+        #error configEVENT_GROUP_ISR_MAX_WAKES must be at least 1
+    #endif
+
+    #if ( configEVENT_GROUP_ISR_MAX_WAITERS < configEVENT_GROUP_ISR_MAX_WAKES )
+        #error configEVENT_GROUP_ISR_MAX_WAITERS must be at least configEVENT_GROUP_ISR_MAX_WAKES
+    #endif
+#endif
+
 #ifndef portTASK_USES_FLOATING_POINT
     #define portTASK_USES_FLOATING_POINT()
 #endif
@@ -2802,6 +3146,10 @@
     #error configTASK_NOTIFICATION_ARRAY_ENTRIES must be at least 1
 #endif
 
+#if ( ( configUSE_SPSC_RINGS == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+    #error configUSE_SPSC_RINGS requires configUSE_TASK_NOTIFICATIONS to be set to 1
+#endif
+
 #ifndef configUSE_POSIX_ERRNO
     #define configUSE_POSIX_ERRNO    0
 #endif
@@ -2900,6 +3248,24 @@
     #define configINITIAL_TICK_COUNT    0
 #endif
 
+/* Set configUSE_DELAYED_TASK_WHEEL to 1 to file tasks that block for fewer than
+ * configDELAYED_TASK_WHEEL_SIZE ticks in a wheel of lists indexed by wake tick,
+ * making blocking and unblocking them O(1).  Longer delays still use the sorted
+ * delayed lists. */
+#ifndef configUSE_DELAYED_TASK_WHEEL
+    #define configUSE_DELAYED_TASK_WHEEL    0
+#endif
+
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+    #ifndef configDELAYED_TASK_WHEEL_SIZE
+        #define configDELAYED_TASK_WHEEL_SIZE    64
+    #endif
+
+    #if ( ( configDELAYED_TASK_WHEEL_SIZE < 32 ) || ( ( configDELAYED_TASK_WHEEL_SIZE & ( configDELAYED_TASK_WHEEL_SIZE - 1 ) ) != 0 ) )
+        #error configDELAYED_TASK_WHEEL_SIZE must be a power of 2 no smaller than 32.
+    #endif
+#endif
+
 #if ( portTICK_TYPE_IS_ATOMIC == 0 )
 
 /* Either variables of tick type cannot be read atomically, or
@@ -3219,6 +3585,9 @@ typedef struct xSTATIC_TCB
     #if ( configUSE_POSIX_ERRNO == 1 )
         int iDummy22;
     #endif
+    #if ( configUSE_QUEUE_HAND_OFF == 1 )
+        void * pvDummy27;
+    #endif
 } StaticTask_t;
 
 /*
@@ -3253,6 +3622,11 @@ typedef struct xSTATIC_QUEUE
         uint8_t ucDummy6;
     #endif
 
+    #if ( configUSE_QUEUE_ZERO_COPY == 1 )
+        uint8_t ucDummy10;
+        void * pvDummy11[ 2 ];
+    #endif
+
     #if ( configUSE_QUEUE_SETS == 1 )
         void * pvDummy7;
     #endif
@@ -3283,6 +3657,10 @@ typedef struct xSTATIC_EVENT_GROUP
     TickType_t xDummy1;
     StaticList_t xDummy2;
 
+    #if ( configUSE_EVENT_GROUP_DIRECT_ISR_SET == 1 )
+        UBaseType_t uxDummy5[ 2 ];
+    #endif
+
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxDummy3;
     #endif
@@ -3350,6 +3728,38 @@ typedef struct xSTATIC_STREAM_BUFFER
 /* Message buffers are built on stream buffers. */
 typedef StaticStreamBuffer_t StaticMessageBuffer_t;
 
+/*
+ * In line with software engineering best practice, FreeRTOS implements a strict
+ * data hiding policy, so the real memory pool structure used by memory_pool.c
+ * is not accessible to the application code.  The StaticMemoryPool_t
+ * structure below has the same size and alignment requirements as the genuine
+ * structure and is provided so the application can allocate the pool control
+ * block alongside the pool storage array.
+ */
+typedef struct xSTATIC_MEMORY_POOL
+{
+    void * pvDummy1[ 3 ];
+    size_t uxDummy2;
+    UBaseType_t uxDummy3[ 3 ];
+} StaticMemoryPool_t;
+
+/*
+ * In line with software engineering best practice, FreeRTOS implements a strict
+ * data hiding policy, so the real SPSC ring structure used by spsc_ring.c is
+ * not accessible to the application code.  The StaticSpscRing_t structure
+ * below has the same size and alignment requirements as the genuine structure
+ * and is provided so the application can allocate the ring control block
+ * alongside the ring storage array.
+ */
+typedef struct xSTATIC_SPSC_RING
+{
+    void * pvDummy1;
+    size_t uxDummy2;
+    uint32_t ulDummy3[ 3 ];
+    void * pvDummy4;
+    UBaseType_t uxDummy5;
+} StaticSpscRing_t;
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
@@ -98,6 +98,59 @@
 #define ATOMIC_COMPARE_AND_SWAP_SUCCESS    0x1U     /**< Compare and swap succeeded, swapped. */
 #define ATOMIC_COMPARE_AND_SWAP_FAILURE    0x0U     /**< Compare and swap failed, did not swap. */
 
+/*----------------------------- Load && Store ----------------------------*/
+
+/**
+ * Atomic load
+ *
+ * @brief Reads a 32-bit value such that no later memory access is performed
+ *        before it.
+ *
+ * @param[in] pulSource  Pointer to the memory location to be read.  Must be
+ *                       32-bit aligned.
+ *
+ * @return The value read.
+ *
+ * @note Aligned 32-bit loads and stores are indivisible on every architecture
+ *       with a 32-bit port, so unlike the other functions in this file the
+ *       load and store functions never enter a critical section and can be
+ *       called from any interrupt.  Only the ordering is enforced, through
+ *       portDATA_MEMORY_BARRIER(), which also orders accesses between cores.
+ */
+static portFORCE_INLINE uint32_t Atomic_Load_u32( uint32_t const volatile * pulSource )
+{
+    uint32_t ulValue;
+
+    ulValue = *pulSource;
+    portDATA_MEMORY_BARRIER();
+
+    return ulValue;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Atomic store
+ *
+ * @brief Writes a 32-bit value after every earlier memory access has
+ *        completed, and before any later one is performed.
+ *
+ * @param[out] pulDestination  Pointer to the memory location to be written.
+ *                             Must be 32-bit aligned.
+ * @param[in] ulValue          The value to write.
+ *
+ * @note The barrier after the store also orders it against later loads, so
+ *       two contexts that each store a flag and then load the other's flag
+ *       cannot both miss the other's store.
+ */
+static portFORCE_INLINE void Atomic_Store_u32( uint32_t volatile * pulDestination,
+                                               uint32_t ulValue )
+{
+    portDATA_MEMORY_BARRIER();
+    *pulDestination = ulValue;
+    portDATA_MEMORY_BARRIER();
+}
+/*-----------------------------------------------------------*/
+
 /*----------------------------- Swap && CAS ------------------------------*/
 
 /**
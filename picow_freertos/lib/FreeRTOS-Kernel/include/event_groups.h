@@ -452,7 +452,7 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup,
  * \defgroup xEventGroupClearBitsFromISR xEventGroupClearBitsFromISR
  * \ingroup EventGroup
  */
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_EVENT_GROUP_DIRECT_ISR_SET == 1 ) )
     BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup,
                                             const EventBits_t uxBitsToClear ) PRIVILEGED_FUNCTION;
 #else
@@ -551,6 +551,16 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
  * context of the timer task - where a scheduler lock is used in place of a
  * critical section.
  *
+ * If configUSE_EVENT_GROUP_DIRECT_ISR_SET is set to 1 in FreeRTOSConfig.h then
+ * the bits are instead set inside the interrupt, and up to
+ * configEVENT_GROUP_ISR_MAX_WAKES waiting tasks are unblocked directly, which
+ * bounds the time spent in the interrupt.  The whole request is still passed
+ * to the timer task if more tasks than that would be unblocked, or if more than
+ * configEVENT_GROUP_ISR_MAX_WAITERS tasks are waiting on the event group (so
+ * the interrupt never walks a long list), or if a task is using the event
+ * group, or an earlier request from an interrupt is still waiting for the
+ * timer task.
+ *
  * @param xEventGroup The event group in which the bits are to be set.
  *
  * @param uxBitsToSet A bitwise value that indicates the bit or bits to set.
@@ -563,7 +573,8 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
  * currently running task (the task the interrupt interrupted) then
  * *pxHigherPriorityTaskWoken will be set to pdTRUE by
  * xEventGroupSetBitsFromISR(), indicating that a context switch should be
- * requested before the interrupt exits.  For that reason
+ * requested before the interrupt exits.  The same applies to a task unblocked
+ * directly by the interrupt.  For that reason
  * *pxHigherPriorityTaskWoken must be initialised to pdFALSE.  See the
  * example code below.
  *
@@ -607,7 +618,7 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
  * \defgroup xEventGroupSetBitsFromISR xEventGroupSetBitsFromISR
  * \ingroup EventGroup
  */
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_EVENT_GROUP_DIRECT_ISR_SET == 1 ) )
     BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup,
                                           const EventBits_t uxBitsToSet,
                                           BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
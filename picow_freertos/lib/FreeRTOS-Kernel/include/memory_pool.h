@@ -0,0 +1,248 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Memory pools hand out fixed size blocks carved from an array supplied by the
+ * application.  Free blocks are kept on a singly linked free list that is
+ * threaded through the blocks themselves, so allocating and freeing a block is
+ * a constant time operation that never fragments, and only masks interrupts
+ * for the few instructions needed to push or pop the head of the list.  Both
+ * operations can therefore be called from tasks and from interrupts alike.
+ *
+ * Pools can also be registered as size classes.  pvMemoryPoolAllocFromSizeClass()
+ * returns a block from the smallest registered pool whose block size can hold
+ * the requested number of bytes.  When configKERNEL_OBJECTS_FROM_MEMORY_POOLS
+ * is set to 1 the kernel allocates task control blocks and queues (including
+ * their storage areas) through the size classes, only falling back to
+ * pvPortMalloc() if no suitable pool has a free block.
+ */
+
+#ifndef MEMORY_POOL_H
+#define MEMORY_POOL_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include memory_pool.h"
+#endif
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * Type by which memory pools are referenced.  For example, a call to
+ * xMemoryPoolCreateStatic() returns a MemoryPoolHandle_t variable that can
+ * then be used as a parameter to pvMemoryPoolAlloc(), vMemoryPoolFree(), etc.
+ */
+struct MemoryPoolDef_t;
+typedef struct MemoryPoolDef_t * MemoryPoolHandle_t;
+
+/**
+ * memory_pool.h
+ *
+ * The size, in bytes, a block occupies in the pool storage area.  Blocks are
+ * at least large enough to hold the free list link and are rounded up to
+ * portBYTE_ALIGNMENT so every block is suitably aligned for any object.
+ */
+#define memorypoolBLOCK_SIZE( xBlockSize )                                                                                  \
+    ( ( ( ( ( size_t ) ( xBlockSize ) < sizeof( void * ) ) ? sizeof( void * ) : ( size_t ) ( xBlockSize ) ) + \
+        ( ( size_t ) portBYTE_ALIGNMENT - 1U ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/**
+ * memory_pool.h
+ *
+ * The size, in bytes, of the storage area that must be passed to
+ * xMemoryPoolCreateStatic() to hold uxBlockCount blocks of xBlockSize bytes.
+ *
+ * Example use:
+ * @code{c}
+ * #define RECORD_COUNT    16
+ *
+ * static uint8_t ucRecordStorage[ memorypoolSTORAGE_SIZE( sizeof( Record_t ), RECORD_COUNT ) ] __attribute__( ( aligned( portBYTE_ALIGNMENT ) ) );
+ * static StaticMemoryPool_t xRecordPoolBuffer;
+ * @endcode
+ */
+#define memorypoolSTORAGE_SIZE( xBlockSize, uxBlockCount )    ( memorypoolBLOCK_SIZE( xBlockSize ) * ( size_t ) ( uxBlockCount ) )
+
+/**
+ * memory_pool.h
+ * @code{c}
+ * MemoryPoolHandle_t xMemoryPoolCreateStatic( size_t xBlockSize,
+ *                                             UBaseType_t uxBlockCount,
+ *                                             uint8_t * pucPoolStorageBuffer,
+ *                                             StaticMemoryPool_t * pxStaticMemoryPool );
+ * @endcode
+ *
+ * Creates a pool of uxBlockCount blocks, each able to hold xBlockSize bytes,
+ * using the statically allocated storage area pucPoolStorageBuffer.
+ *
+ * configUSE_MEMORY_POOLS must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * @param xBlockSize The number of bytes each block must be able to hold.
+ *
+ * @param uxBlockCount The number of blocks in the pool.
+ *
+ * @param pucPoolStorageBuffer Must point to an array of at least
+ * memorypoolSTORAGE_SIZE( xBlockSize, uxBlockCount ) bytes, aligned to
+ * portBYTE_ALIGNMENT.
+ *
+ * @param pxStaticMemoryPool Must point to a variable of type
+ * StaticMemoryPool_t, which will be used to hold the pool's data structure.
+ *
+ * @return If the pool is created then a handle to the created pool is
+ * returned.  If either pucPoolStorageBuffer or pxStaticMemoryPool are NULL
+ * then NULL is returned.
+ */
+MemoryPoolHandle_t xMemoryPoolCreateStatic( size_t xBlockSize,
+                                            UBaseType_t uxBlockCount,
+                                            uint8_t * pucPoolStorageBuffer,
+                                            StaticMemoryPool_t * pxStaticMemoryPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * memory_pool.h
+ * @code{c}
+ * void * pvMemoryPoolAlloc( MemoryPoolHandle_t xMemoryPool );
+ * @endcode
+ *
+ * Takes a block from the pool.  This function never blocks and can be called
+ * from a task or from an interrupt service routine.
+ *
+ * @param xMemoryPool The handle of the pool to allocate from.
+ *
+ * @return A pointer to the block, or NULL if the pool has no free blocks.
+ */
+void * pvMemoryPoolAlloc( MemoryPoolHandle_t xMemoryPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * memory_pool.h
+ * @code{c}
+ * void vMemoryPoolFree( MemoryPoolHandle_t xMemoryPool, void * pvBlock );
+ * @endcode
+ *
+ * Returns a block previously obtained from pvMemoryPoolAlloc() to the pool.
+ * This function can be called from a task or from an interrupt service
+ * routine.
+ *
+ * @param xMemoryPool The handle of the pool the block was allocated from.
+ *
+ * @param pvBlock The block being returned.  Passing NULL has no effect.
+ */
+void vMemoryPoolFree( MemoryPoolHandle_t xMemoryPool,
+                      void * pvBlock ) PRIVILEGED_FUNCTION;
+
+/**
+ * memory_pool.h
+ * @code{c}
+ * BaseType_t xMemoryPoolAddSizeClass( MemoryPoolHandle_t xMemoryPool );
+ * @endcode
+ *
+ * Registers the pool as a size class used by pvMemoryPoolAllocFromSizeClass(),
+ * and therefore by the kernel when configKERNEL_OBJECTS_FROM_MEMORY_POOLS is
+ * set to 1.  Up to configMEMORY_POOL_MAX_SIZE_CLASSES pools can be registered,
+ * and they are kept ordered by block size.  Size classes should be registered
+ * before the scheduler is started, and before any kernel object is created.
+ *
+ * @param xMemoryPool The handle of the pool to register.
+ *
+ * @return pdPASS if the pool was registered, otherwise pdFAIL.
+ */
+BaseType_t xMemoryPoolAddSizeClass( MemoryPoolHandle_t xMemoryPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * memory_pool.h
+ * @code{c}
+ * void * pvMemoryPoolAllocFromSizeClass( size_t xWantedSize );
+ * @endcode
+ *
+ * Takes a block from the smallest registered size class able to hold
+ * xWantedSize bytes that still has a free block.  This function never blocks
+ * and can be called from a task or from an interrupt service routine.
+ *
+ * @param xWantedSize The number of bytes required.
+ *
+ * @return A pointer to the block, or NULL if no size class could satisfy the
+ * request.
+ */
+void * pvMemoryPoolAllocFromSizeClass( size_t xWantedSize ) PRIVILEGED_FUNCTION;
+
+/**
+ * memory_pool.h
+ * @code{c}
+ * BaseType_t xMemoryPoolFreeToSizeClass( void * pvBlock );
+ * @endcode
+ *
+ * Returns pvBlock to whichever registered size class it was allocated from.
+ *
+ * @param pvBlock The block being returned.
+ *
+ * @return pdTRUE if pvBlock belonged to a registered size class and was
+ * returned to it, otherwise pdFALSE, in which case the block was not allocated
+ * by pvMemoryPoolAllocFromSizeClass() and must be freed by other means.
+ */
+BaseType_t xMemoryPoolFreeToSizeClass( void * pvBlock ) PRIVILEGED_FUNCTION;
+
+/**
+ * memory_pool.h
+ * @code{c}
+ * UBaseType_t uxMemoryPoolGetFreeBlockCount( MemoryPoolHandle_t xMemoryPool );
+ * @endcode
+ *
+ * @return The number of blocks currently free in the pool.
+ */
+UBaseType_t uxMemoryPoolGetFreeBlockCount( MemoryPoolHandle_t xMemoryPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * memory_pool.h
+ * @code{c}
+ * UBaseType_t uxMemoryPoolGetMinimumEverFreeBlockCount( MemoryPoolHandle_t xMemoryPool );
+ * @endcode
+ *
+ * @return The lowest number of free blocks the pool has had since it was
+ * created, which can be used to size the pool.
+ */
+UBaseType_t uxMemoryPoolGetMinimumEverFreeBlockCount( MemoryPoolHandle_t xMemoryPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * memory_pool.h
+ * @code{c}
+ * size_t xMemoryPoolGetBlockSize( MemoryPoolHandle_t xMemoryPool );
+ * @endcode
+ *
+ * @return The usable size, in bytes, of each block in the pool.
+ */
+size_t xMemoryPoolGetBlockSize( MemoryPoolHandle_t xMemoryPool ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* !defined( MEMORY_POOL_H ) */
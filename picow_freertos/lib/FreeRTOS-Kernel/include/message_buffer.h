@@ -692,6 +692,56 @@ typedef StreamBufferHandle_t MessageBufferHandle_t;
 #define xMessageBufferReceiveFromISR( xMessageBuffer, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken ) \
     xStreamBufferReceiveFromISR( ( xMessageBuffer ), ( pvRxData ), ( xBufferLengthBytes ), ( pxHigherPriorityTaskWoken ) )
 
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * size_t xMessageBufferGetWriteWindow( MessageBufferHandle_t xMessageBuffer,
+ *                                      StreamBufferWindow_t * const pxWindow,
+ *                                      size_t xMessageLength,
+ *                                      TickType_t xTicksToWait );
+ * size_t xMessageBufferCommitWrite( MessageBufferHandle_t xMessageBuffer,
+ *                                   size_t xMessageLength );
+ * size_t xMessageBufferCommitWriteFromISR( MessageBufferHandle_t xMessageBuffer,
+ *                                          size_t xMessageLength,
+ *                                          BaseType_t * const pxHigherPriorityTaskWoken );
+ * size_t xMessageBufferGetReadWindow( MessageBufferHandle_t xMessageBuffer,
+ *                                     StreamBufferWindow_t * const pxWindow,
+ *                                     TickType_t xTicksToWait );
+ * size_t xMessageBufferCommitRead( MessageBufferHandle_t xMessageBuffer );
+ * size_t xMessageBufferCommitReadFromISR( MessageBufferHandle_t xMessageBuffer,
+ *                                         BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Build a message in place in the message buffer's storage area, or use the
+ * next message where it lies, instead of copying it in or out.  Getting a write
+ * window waits until a message of xMessageLength bytes fits, and the window is
+ * the largest message that currently fits.  The message is sent when it is
+ * committed with its length.  A read window holds exactly the next message,
+ * which is removed when it is committed.  See xStreamBufferGetWriteWindow()
+ * and xStreamBufferGetReadWindow() for details.
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * these macros to be available.
+ *
+ * \defgroup xMessageBufferGetWriteWindow xMessageBufferGetWriteWindow
+ * \ingroup MessageBufferManagement
+ */
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+    #define xMessageBufferGetWriteWindow( xMessageBuffer, pxWindow, xMessageLength, xTicksToWait ) \
+    xStreamBufferGetWriteWindow( ( xMessageBuffer ), ( pxWindow ), ( xMessageLength ), ( xTicksToWait ) )
+    #define xMessageBufferCommitWrite( xMessageBuffer, xMessageLength ) \
+    xStreamBufferCommitWrite( ( xMessageBuffer ), ( xMessageLength ) )
+    #define xMessageBufferCommitWriteFromISR( xMessageBuffer, xMessageLength, pxHigherPriorityTaskWoken ) \
+    xStreamBufferCommitWriteFromISR( ( xMessageBuffer ), ( xMessageLength ), ( pxHigherPriorityTaskWoken ) )
+    #define xMessageBufferGetReadWindow( xMessageBuffer, pxWindow, xTicksToWait ) \
+    xStreamBufferGetReadWindow( ( xMessageBuffer ), ( pxWindow ), ( xTicksToWait ) )
+    #define xMessageBufferCommitRead( xMessageBuffer ) \
+    xStreamBufferCommitRead( ( xMessageBuffer ), ( size_t ) 0 )
+    #define xMessageBufferCommitReadFromISR( xMessageBuffer, pxHigherPriorityTaskWoken ) \
+    xStreamBufferCommitReadFromISR( ( xMessageBuffer ), ( size_t ) 0, ( pxHigherPriorityTaskWoken ) )
+#endif
+
 /**
  * message_buffer.h
  *
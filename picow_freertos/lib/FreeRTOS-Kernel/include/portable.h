@@ -164,6 +164,50 @@ typedef struct xHeapStats
     size_t xNumberOfSuccessfulFrees;        /* The number of calls to vPortFree() that has successfully freed a block of memory. */
 } HeapStats_t;
 
+#ifndef configHEAP_TRACE_ALLOCATIONS
+    #define configHEAP_TRACE_ALLOCATIONS    0
+#endif
+
+#if ( configHEAP_TRACE_ALLOCATIONS == 1 )
+
+    #ifndef configHEAP_TRACE_BUFFER_LENGTH
+        #define configHEAP_TRACE_BUFFER_LENGTH    64
+    #endif
+
+    #ifndef configHEAP_FREE_BLOCK_HISTOGRAM_BUCKETS
+        #define configHEAP_FREE_BLOCK_HISTOGRAM_BUCKETS    14
+    #endif
+
+/* Values of the ucEvent member of HeapTraceRecord_t. */
+    #define heapTRACE_EVENT_MALLOC           ( ( uint8_t ) 0U )
+    #define heapTRACE_EVENT_FREE             ( ( uint8_t ) 1U )
+    #define heapTRACE_EVENT_MALLOC_FAILED    ( ( uint8_t ) 2U )
+
+/* One heap event, as returned by uxPortGetHeapTraceRecords(). */
+    typedef struct xHeapTraceRecord
+    {
+        void * pvAddress;       /* The block returned to (or by) the application, NULL for a failed allocation. */
+        size_t xRequestedSize;  /* The size passed to pvPortMalloc(), 0 for a free. */
+        size_t xBlockSize;      /* The bytes taken from or returned to the heap, including the block header and alignment padding. */
+        void * pvCaller;        /* The return address of the pvPortMalloc() or vPortFree() call. */
+        void * pvTask;          /* The handle of the calling task, NULL if the scheduler had not been started. */
+        uint32_t ulTimestamp;   /* The value of configHEAP_TRACE_GET_TIMESTAMP() when the event was recorded. */
+        uint8_t ucEvent;        /* One of the heapTRACE_EVENT_ values above. */
+    } HeapTraceRecord_t;
+
+/* Free block size histogram, as returned by vPortGetHeapFreeBlockHistogram().
+ * Bucket n counts the free blocks whose size, including the block header, is
+ * at least ( 16 << n ) bytes and less than ( 32 << n ) bytes.  The first
+ * bucket also counts anything smaller and the last bucket also counts anything
+ * larger. */
+    typedef struct xHeapFreeBlockHistogram
+    {
+        size_t xNumberOfFreeBlocks[ configHEAP_FREE_BLOCK_HISTOGRAM_BUCKETS ];
+        size_t xFreeBytes[ configHEAP_FREE_BLOCK_HISTOGRAM_BUCKETS ];
+    } HeapFreeBlockHistogram_t;
+
+#endif /* configHEAP_TRACE_ALLOCATIONS */
+
 /*
  * Used to define multiple heap regions for use by heap_5.c.  This function
  * must be called before any calls to pvPortMalloc() - not creating a task,
@@ -183,6 +227,31 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEG
  */
 void vPortGetHeapStats( HeapStats_t * pxHeapStats );
 
+#if ( configHEAP_TRACE_ALLOCATIONS == 1 )
+
+/*
+ * Copies up to uxMaxRecords of the most recent heap events into pxRecords,
+ * oldest first, and returns the number of records copied.  Only the last
+ * configHEAP_TRACE_BUFFER_LENGTH events are retained.
+ */
+    UBaseType_t uxPortGetHeapTraceRecords( HeapTraceRecord_t * pxRecords,
+                                           UBaseType_t uxMaxRecords );
+
+/*
+ * Returns the number of heap events recorded since the heap was initialised,
+ * including those that have since been overwritten in the trace buffer.
+ */
+    size_t xPortGetHeapTraceEventCount( void );
+
+/*
+ * Fills pxHistogram with the distribution of free block sizes, which shows how
+ * fragmented the heap is and therefore whether a large allocation (such as a
+ * task stack) is likely to succeed even though enough bytes are free in total.
+ */
+    void vPortGetHeapFreeBlockHistogram( HeapFreeBlockHistogram_t * pxHistogram );
+
+#endif /* configHEAP_TRACE_ALLOCATIONS */
+
 /*
  * Map to the memory management routines required for the port.
  */
@@ -203,6 +272,14 @@ void xPortResetHeapMinimumEverFreeHeapSize( void ) PRIVILEGED_FUNCTION;
     #define vPortFreeStack       vPortFree
 #endif
 
+#if ( configKERNEL_OBJECTS_FROM_MEMORY_POOLS == 1 )
+    void * pvPortMallocKernelObject( size_t xSize ) PRIVILEGED_FUNCTION;
+    void vPortFreeKernelObject( void * pv ) PRIVILEGED_FUNCTION;
+#else
+    #define pvPortMallocKernelObject    pvPortMalloc
+    #define vPortFreeKernelObject       vPortFree
+#endif
+
 /*
  * This function resets the internal state of the heap module. It must be called
  * by the application before restarting the scheduler.
@@ -914,6 +914,293 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                           void * const pvBuffer,
                           TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueReserve(
+ *                           QueueHandle_t xQueue,
+ *                           void ** const ppvSlot,
+ *                           TickType_t xTicksToWait
+ *                         );
+ * @endcode
+ *
+ * Reserve the slot at the back of a queue so the item can be written into the
+ * queue's storage area in place, rather than built in a buffer and copied in
+ * by xQueueSend().  The item is not visible to receivers until xQueueCommit()
+ * is called.  Only one slot can be reserved at a time, and while it is
+ * reserved every other send to the queue (including another xQueueReserve())
+ * blocks as if the queue were full.
+ *
+ * configUSE_QUEUE_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.  This function must not be called from an
+ * interrupt service routine.
+ *
+ * @param xQueue The handle to the queue, which must store items by copy (it
+ * cannot be a semaphore or mutex).
+ *
+ * @param ppvSlot Set to point to the reserved slot, which is uxItemSize bytes
+ * long.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for a slot should the queue be full, or a slot already be reserved,
+ * at the time of the call.
+ *
+ * @return pdPASS if a slot was reserved, otherwise errQUEUE_FULL.
+ *
+ * Example usage:
+ * @code{c}
+ * void vADCTask( void *pvParameters )
+ * {
+ * ADCBlock_t *pxBlock;
+ *
+ *  for( ;; )
+ *  {
+ *      if( xQueueReserve( xADCQueue, ( void ** ) &pxBlock, portMAX_DELAY ) == pdPASS )
+ *      {
+ *          // Fill the block directly in the queue storage.
+ *          vReadSamples( pxBlock->usSamples, BLOCK_LENGTH );
+ *          xQueueCommit( xADCQueue, pxBlock );
+ *      }
+ *  }
+ * }
+ * @endcode
+ * \defgroup xQueueReserve xQueueReserve
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+    BaseType_t xQueueReserve( QueueHandle_t xQueue,
+                              void ** const ppvSlot,
+                              TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueCommit( QueueHandle_t xQueue, void * const pvSlot );
+ * @endcode
+ *
+ * Post the item written into a slot obtained from xQueueReserve() to the back
+ * of the queue, unblocking a task waiting to receive from it as xQueueSend()
+ * would.  Only the task that reserved the slot may commit it, and the slot
+ * must not be accessed after it is committed.
+ *
+ * @param xQueue The handle to the queue the slot was reserved on.
+ *
+ * @param pvSlot The slot returned by xQueueReserve().
+ *
+ * @return pdPASS if the item was posted, or pdFAIL if pvSlot is not the
+ * queue's reserved slot.
+ *
+ * \defgroup xQueueCommit xQueueCommit
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+    BaseType_t xQueueCommit( QueueHandle_t xQueue,
+                             void * const pvSlot ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueAcquire(
+ *                           QueueHandle_t xQueue,
+ *                           void ** const ppvItem,
+ *                           TickType_t xTicksToWait
+ *                         );
+ * @endcode
+ *
+ * Obtain a pointer to the item at the front of a queue so it can be used in
+ * place, rather than copied out by xQueueReceive().  The item stays in the
+ * queue, and its slot cannot be reused, until xQueueRelease() is called.  Only
+ * one item can be acquired at a time, and while it is acquired every other
+ * receive or peek blocks as if the queue were empty, as do sends to the front
+ * of the queue.  Sends to the back of the queue, including xQueueReserve(),
+ * are not affected, so a producer can fill the next slot while the consumer
+ * works on this one.  xQueueOverwrite() must not be used on a queue that is
+ * accessed with this API.
+ *
+ * configUSE_QUEUE_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.  This function must not be called from an
+ * interrupt service routine.
+ *
+ * @param xQueue The handle to the queue, which must store items by copy.
+ *
+ * @param ppvItem Set to point to the item, which is uxItemSize bytes long.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for an item should the queue be empty, or its front item already be
+ * acquired, at the time of the call.
+ *
+ * @return pdPASS if an item was acquired, otherwise errQUEUE_EMPTY.
+ *
+ * Example usage:
+ * @code{c}
+ * void vTelemetryTask( void *pvParameters )
+ * {
+ * Telemetry_t *pxRecord;
+ *
+ *  for( ;; )
+ *  {
+ *      if( xQueueAcquire( xTelemetryQueue, ( void ** ) &pxRecord, portMAX_DELAY ) == pdPASS )
+ *      {
+ *          vTransmitRecord( pxRecord );
+ *          xQueueRelease( xTelemetryQueue, pxRecord );
+ *      }
+ *  }
+ * }
+ * @endcode
+ * \defgroup xQueueAcquire xQueueAcquire
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+    BaseType_t xQueueAcquire( QueueHandle_t xQueue,
+                              void ** const ppvItem,
+                              TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueRelease( QueueHandle_t xQueue, const void * const pvItem );
+ * @endcode
+ *
+ * Remove an item obtained from xQueueAcquire() from the queue, unblocking a
+ * task waiting to send to it as xQueueReceive() would.  Only the task that
+ * acquired the item may release it, and the item must not be accessed after
+ * it is released.
+ *
+ * @param xQueue The handle to the queue the item was acquired from.
+ *
+ * @param pvItem The item returned by xQueueAcquire().
+ *
+ * @return pdPASS if the item was removed, or pdFAIL if pvItem is not the
+ * queue's acquired item.
+ *
+ * \defgroup xQueueRelease xQueueRelease
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+    BaseType_t xQueueRelease( QueueHandle_t xQueue,
+                              const void * const pvItem ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * UBaseType_t xQueueSendMultiple(
+ *                                 QueueHandle_t xQueue,
+ *                                 const void * pvItems,
+ *                                 UBaseType_t uxItemCount,
+ *                                 TickType_t xTicksToWait
+ *                               );
+ * @endcode
+ *
+ * Post up to uxItemCount items, held back to back in pvItems, to the back of a
+ * queue in one operation.  The items are copied into the queue storage area
+ * with at most two memcpy() calls, one either side of the point where the
+ * storage area wraps, inside a single critical section, and the tasks waiting
+ * to receive are unblocked in one pass at the end.  That makes a burst much
+ * cheaper than the same number of xQueueSend() calls, but interrupts stay
+ * masked while the whole burst is copied, so uxItemCount should be kept
+ * small enough for the system's interrupt latency budget.
+ *
+ * As many items as there is space for are posted, so fewer than uxItemCount
+ * may be sent.  The call only blocks while the queue is full.
+ *
+ * configUSE_QUEUE_MULTIPLE_ITEMS must be set to 1 in FreeRTOSConfig.h for
+ * this function to be available.  This function must not be called from an
+ * interrupt service routine.
+ *
+ * @param xQueue The handle to the queue, which must store items by copy.
+ *
+ * @param pvItems Pointer to the first of the items to be queued.
+ *
+ * @param uxItemCount The number of items at pvItems, which must be at least
+ * one.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block waiting
+ * for space to become available on the queue, should it be full.
+ *
+ * @return The number of items posted, which is zero if the queue stayed full
+ * for xTicksToWait ticks.
+ *
+ * Example usage:
+ * @code{c}
+ * void vADCTask( void *pvParameters )
+ * {
+ * uint16_t usSamples[ 8 ];
+ * UBaseType_t uxSent;
+ *
+ *  for( ;; )
+ *  {
+ *      vReadADCBurst( usSamples, 8 );
+ *
+ *      for( uxSent = 0; uxSent < 8; )
+ *      {
+ *          uxSent += xQueueSendMultiple( xSampleQueue, &( usSamples[ uxSent ] ), 8 - uxSent, portMAX_DELAY );
+ *      }
+ *  }
+ * }
+ * @endcode
+ * \defgroup xQueueSendMultiple xQueueSendMultiple
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 )
+    UBaseType_t xQueueSendMultiple( QueueHandle_t xQueue,
+                                    const void * pvItems,
+                                    UBaseType_t uxItemCount,
+                                    TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * UBaseType_t xQueueReceiveMultiple(
+ *                                    QueueHandle_t xQueue,
+ *                                    void * pvBuffer,
+ *                                    UBaseType_t uxMaxItems,
+ *                                    TickType_t xTicksToWait
+ *                                  );
+ * @endcode
+ *
+ * Receive up to uxMaxItems items from a queue in one operation, the
+ * counterpart of xQueueSendMultiple().  The items are copied out of the queue
+ * storage area with at most two memcpy() calls inside a single critical
+ * section, and the tasks waiting to send are unblocked in one pass at the end.
+ *
+ * Whatever items are in the queue, up to uxMaxItems, are received, so fewer
+ * than uxMaxItems may be returned.  The call only blocks while the queue is
+ * empty.  A queue that is a member of a queue set should not be read with
+ * this function, as the set only holds one entry per item.
+ *
+ * configUSE_QUEUE_MULTIPLE_ITEMS must be set to 1 in FreeRTOSConfig.h for
+ * this function to be available.  This function must not be called from an
+ * interrupt service routine.
+ *
+ * @param xQueue The handle to the queue, which must store items by copy.
+ *
+ * @param pvBuffer Pointer to the buffer into which the received items are
+ * copied back to back.  It must be able to hold uxMaxItems items.
+ *
+ * @param uxMaxItems The maximum number of items to receive, which must be at
+ * least one.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block waiting
+ * for an item should the queue be empty.
+ *
+ * @return The number of items received, which is zero if the queue stayed
+ * empty for xTicksToWait ticks.
+ *
+ * \defgroup xQueueReceiveMultiple xQueueReceiveMultiple
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 )
+    UBaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue,
+                                       void * pvBuffer,
+                                       UBaseType_t uxMaxItems,
+                                       TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * queue. h
  * @code{c}
@@ -0,0 +1,279 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * SPSC rings pass fixed size items from exactly one producer to exactly one
+ * consumer, for example from a high rate GPIO or ADC interrupt to the task that
+ * processes the samples.  The producer only writes the head index and the
+ * consumer only writes the tail index, so neither side ever enters a critical
+ * section or touches a kernel list - the indexes are published with the
+ * Atomic_Load_u32() and Atomic_Store_u32() ordering from atomic.h, which also
+ * makes a ring safe to use when the producer and consumer run on different
+ * cores.
+ *
+ * The only kernel call is made when a push makes an empty ring non-empty, at
+ * which point the consumer task registered with vSpscRingSetConsumerTask() is
+ * sent a task notification.  While the consumer is busy draining the ring the
+ * producer does not notify it at all.
+ */
+
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include spsc_ring.h"
+#endif
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * Type by which SPSC rings are referenced.  For example, a call to
+ * xSpscRingCreateStatic() returns a SpscRingHandle_t variable that can then be
+ * used as a parameter to xSpscRingPushFromISR(), xSpscRingReceive(), etc.
+ */
+struct SpscRingDef_t;
+typedef struct SpscRingDef_t * SpscRingHandle_t;
+
+/**
+ * spsc_ring.h
+ *
+ * The size, in bytes, of the storage area that must be passed to
+ * xSpscRingCreateStatic() to hold uxLength items of xItemSize bytes.
+ *
+ * Example use:
+ * @code{c}
+ * #define SAMPLE_COUNT    64
+ *
+ * static uint8_t ucSampleStorage[ spscringSTORAGE_SIZE( sizeof( uint16_t ), SAMPLE_COUNT ) ];
+ * static StaticSpscRing_t xSampleRingBuffer;
+ * @endcode
+ */
+#define spscringSTORAGE_SIZE( xItemSize, uxLength )    ( ( size_t ) ( xItemSize ) * ( size_t ) ( uxLength ) )
+
+/**
+ * spsc_ring.h
+ * @code{c}
+ * SpscRingHandle_t xSpscRingCreateStatic( size_t xItemSize,
+ *                                         UBaseType_t uxLength,
+ *                                         uint8_t * pucRingStorageBuffer,
+ *                                         StaticSpscRing_t * pxStaticRing );
+ * @endcode
+ *
+ * Creates a ring that can hold uxLength items of xItemSize bytes each, using
+ * the statically allocated storage area pucRingStorageBuffer.
+ *
+ * configUSE_SPSC_RINGS must be set to 1 in FreeRTOSConfig.h for this function
+ * to be available.
+ *
+ * @param xItemSize The size, in bytes, of each item.
+ *
+ * @param uxLength The number of items the ring can hold.  Must be a power of
+ * two so the indexes can be wrapped with a mask.
+ *
+ * @param pucRingStorageBuffer Must point to an array of at least
+ * spscringSTORAGE_SIZE( xItemSize, uxLength ) bytes.
+ *
+ * @param pxStaticRing Must point to a variable of type StaticSpscRing_t, which
+ * will be used to hold the ring's data structure.
+ *
+ * @return If the ring is created then a handle to the created ring is
+ * returned.  If either pucRingStorageBuffer or pxStaticRing are NULL then NULL
+ * is returned.
+ */
+SpscRingHandle_t xSpscRingCreateStatic( size_t xItemSize,
+                                        UBaseType_t uxLength,
+                                        uint8_t * pucRingStorageBuffer,
+                                        StaticSpscRing_t * pxStaticRing ) PRIVILEGED_FUNCTION;
+
+/**
+ * spsc_ring.h
+ * @code{c}
+ * void vSpscRingSetConsumerTask( SpscRingHandle_t xRing,
+ *                                TaskHandle_t xTaskToNotify,
+ *                                UBaseType_t uxIndexToNotify );
+ * @endcode
+ *
+ * Registers the task that consumes items from the ring.  The task is sent a
+ * notification, as if by xTaskNotifyGiveIndexed(), each time a push makes the
+ * ring non-empty, which is what xSpscRingReceive() waits for.  Call this before
+ * the producer starts pushing.
+ *
+ * @param xRing The handle of the ring.
+ *
+ * @param xTaskToNotify The consumer task, or NULL to stop notifications.
+ *
+ * @param uxIndexToNotify The index within the consumer's array of notification
+ * values to use.  Stream buffers and the xTaskNotify() family use
+ * tskDEFAULT_INDEX_TO_NOTIFY, so a task that also waits on those should
+ * dedicate another index to the ring, which requires
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES to be greater than 1.
+ */
+void vSpscRingSetConsumerTask( SpscRingHandle_t xRing,
+                               TaskHandle_t xTaskToNotify,
+                               UBaseType_t uxIndexToNotify ) PRIVILEGED_FUNCTION;
+
+/**
+ * spsc_ring.h
+ * @code{c}
+ * BaseType_t xSpscRingPush( SpscRingHandle_t xRing, const void * pvItem );
+ * @endcode
+ *
+ * Copies an item into the ring from a task.  Only one task or interrupt may
+ * ever push to a given ring.  This function never blocks.
+ *
+ * @param xRing The handle of the ring.
+ *
+ * @param pvItem A pointer to the item to copy into the ring.
+ *
+ * @return pdPASS if the item was pushed, or pdFAIL if the ring was full.
+ */
+BaseType_t xSpscRingPush( SpscRingHandle_t xRing,
+                          const void * pvItem ) PRIVILEGED_FUNCTION;
+
+/**
+ * spsc_ring.h
+ * @code{c}
+ * BaseType_t xSpscRingPushFromISR( SpscRingHandle_t xRing,
+ *                                  const void * pvItem,
+ *                                  BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Interrupt safe version of xSpscRingPush().  Interrupts are not masked
+ * unless the push makes the ring non-empty and the consumer task has to be
+ * notified.
+ *
+ * @param xRing The handle of the ring.
+ *
+ * @param pvItem A pointer to the item to copy into the ring.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if notifying the consumer
+ * unblocked a task with a priority higher than the interrupted task, in which
+ * case a context switch should be requested before the interrupt exits.  Can
+ * be NULL.
+ *
+ * @return pdPASS if the item was pushed, or pdFAIL if the ring was full.
+ *
+ * Example use:
+ * @code{c}
+ * void vADCInterruptHandler( void )
+ * {
+ * BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+ * uint16_t usSample = adc_fifo_get();
+ *
+ *  // A full ring drops the sample, the ISR never waits.
+ *  ( void ) xSpscRingPushFromISR( xSampleRing, &usSample, &xHigherPriorityTaskWoken );
+ *  portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+ * }
+ *
+ * void vSampleTask( void * pvParameters )
+ * {
+ * uint16_t usSample;
+ *
+ *  vSpscRingSetConsumerTask( xSampleRing, xTaskGetCurrentTaskHandle(), 1 );
+ *
+ *  for( ;; )
+ *  {
+ *      if( xSpscRingReceive( xSampleRing, &usSample, portMAX_DELAY ) == pdPASS )
+ *      {
+ *          vProcessSample( usSample );
+ *      }
+ *  }
+ * }
+ * @endcode
+ */
+BaseType_t xSpscRingPushFromISR( SpscRingHandle_t xRing,
+                                 const void * pvItem,
+                                 BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * spsc_ring.h
+ * @code{c}
+ * BaseType_t xSpscRingPop( SpscRingHandle_t xRing, void * pvBuffer );
+ * @endcode
+ *
+ * Copies the oldest item out of the ring and removes it.  Only one task or
+ * interrupt may ever pop from a given ring.  This function never blocks and
+ * never masks interrupts, so it can be called from an interrupt.
+ *
+ * @param xRing The handle of the ring.
+ *
+ * @param pvBuffer A pointer to the buffer into which the item is copied.
+ *
+ * @return pdPASS if an item was popped, or pdFAIL if the ring was empty.
+ */
+BaseType_t xSpscRingPop( SpscRingHandle_t xRing,
+                         void * pvBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * spsc_ring.h
+ * @code{c}
+ * BaseType_t xSpscRingReceive( SpscRingHandle_t xRing,
+ *                              void * pvBuffer,
+ *                              TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Pops the oldest item from the ring, waiting for one to arrive if the ring is
+ * empty.  Must only be called by the task registered with
+ * vSpscRingSetConsumerTask().
+ *
+ * @param xRing The handle of the ring.
+ *
+ * @param pvBuffer A pointer to the buffer into which the item is copied.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for an item if the ring is empty.
+ *
+ * @return pdPASS if an item was popped, or pdFAIL if the ring stayed empty for
+ * xTicksToWait ticks.
+ */
+BaseType_t xSpscRingReceive( SpscRingHandle_t xRing,
+                             void * pvBuffer,
+                             TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * spsc_ring.h
+ * @code{c}
+ * UBaseType_t uxSpscRingItemsWaiting( SpscRingHandle_t xRing );
+ * @endcode
+ *
+ * @return The number of items in the ring.  The value is a snapshot, and is
+ * only exact when called by the producer or the consumer.
+ */
+UBaseType_t uxSpscRingItemsWaiting( SpscRingHandle_t xRing ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* !defined( SPSC_RING_H ) */
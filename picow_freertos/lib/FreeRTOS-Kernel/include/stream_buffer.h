@@ -85,6 +85,23 @@ typedef void (* StreamBufferCallbackFunction_t)( StreamBufferHandle_t xStreamBuf
                                                  BaseType_t xIsInsideISR,
                                                  BaseType_t * const pxHigherPriorityTaskWoken );
 
+/**
+ * Type used to describe a region of a stream buffer's storage area returned by
+ * xStreamBufferGetWriteWindow() or xStreamBufferGetReadWindow().  The region
+ * starts at pucFirst.  If it wraps past the end of the storage area its
+ * remaining xSecondLength bytes start at pucSecond, otherwise pucSecond is
+ * NULL and xSecondLength is 0.
+ */
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+    typedef struct xSTREAM_BUFFER_WINDOW
+    {
+        uint8_t * pucFirst;
+        size_t xFirstLength;
+        uint8_t * pucSecond;
+        size_t xSecondLength;
+    } StreamBufferWindow_t;
+#endif
+
 /**
  * stream_buffer.h
  *
@@ -879,6 +896,228 @@ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
                                     size_t xBufferLengthBytes,
                                     BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferGetWriteWindow( StreamBufferHandle_t xStreamBuffer,
+ *                                     StreamBufferWindow_t * const pxWindow,
+ *                                     size_t xMinimumBytes,
+ *                                     TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Describes the free space in a stream buffer so the writer, or a DMA engine
+ * working on the writer's behalf, can place data directly into the buffer's
+ * storage area instead of having xStreamBufferSend() copy it there.  Nothing
+ * becomes visible to the reader until xStreamBufferCommitWrite() is called.
+ *
+ * The free space is returned as one or, if it wraps past the end of the
+ * storage area, two contiguous regions in *pxWindow.  The window stays valid
+ * until it is committed, and can only grow as the reader removes data.  As
+ * with xStreamBufferSend(), only one task or interrupt may write to a stream
+ * buffer, and it must not call xStreamBufferSend() while it holds a window.
+ *
+ * For a message buffer the window is where the next message goes, after the
+ * space needed to store the message's length.  The message is committed
+ * whole by xStreamBufferCommitWrite().
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xStreamBufferGetWriteWindow() to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer being written to.
+ *
+ * @param pxWindow Set to describe the free space.
+ *
+ * @param xMinimumBytes The number of bytes the caller wants to be able to
+ * write, for example the length of the next message.  The calling task blocks
+ * until at least this many bytes are free, or xTicksToWait expires.  Values
+ * of 0 are treated as 1.  A stream buffer never waits for more than its
+ * capacity, and a message buffer that could never hold xMinimumBytes does not
+ * wait at all.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should
+ * remain in the Blocked state to wait for xMinimumBytes to become free.  Must
+ * be 0 when called from an interrupt service routine.
+ *
+ * @return The number of bytes that can be written, which is the sum of the
+ * two region lengths.  This can be less than xMinimumBytes if the call timed
+ * out, and more if additional space was already free.
+ *
+ * Example use:
+ * @code{c}
+ * void vStartADCTransfer( StreamBufferHandle_t xStreamBuffer )
+ * {
+ * StreamBufferWindow_t xWindow;
+ *
+ *  // Let the DMA engine write straight into the stream buffer, stopping at
+ *  // the wrap so one transfer fills one contiguous region.
+ *  if( xStreamBufferGetWriteWindow( xStreamBuffer, &xWindow, 1, 0 ) > 0 )
+ *  {
+ *      vStartDMA( xWindow.pucFirst, xWindow.xFirstLength );
+ *  }
+ * }
+ *
+ * void vDMACompleteISR( void )
+ * {
+ * BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+ *
+ *  xStreamBufferCommitWriteFromISR( xStreamBuffer, xDMABytesTransferred(), &xHigherPriorityTaskWoken );
+ *  vStartADCTransfer( xStreamBuffer );
+ *  portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+ * }
+ * @endcode
+ * \defgroup xStreamBufferGetWriteWindow xStreamBufferGetWriteWindow
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+    size_t xStreamBufferGetWriteWindow( StreamBufferHandle_t xStreamBuffer,
+                                        StreamBufferWindow_t * const pxWindow,
+                                        size_t xMinimumBytes,
+                                        TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferCommitWrite( StreamBufferHandle_t xStreamBuffer,
+ *                                  size_t xBytesWritten );
+ * size_t xStreamBufferCommitWriteFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                         size_t xBytesWritten,
+ *                                         BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Makes the first xBytesWritten bytes of the window returned by
+ * xStreamBufferGetWriteWindow() available to the reader, unblocking a task
+ * waiting to receive just as xStreamBufferSend() and
+ * xStreamBufferSendFromISR() do.  The bytes are taken in order from the
+ * first region and then the second.  For a message buffer xBytesWritten is
+ * the length of the message, which must not be longer than the window.
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * these functions to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer being written to.
+ *
+ * @param xBytesWritten The number of bytes placed in the window.
+ *
+ * @param pxHigherPriorityTaskWoken Used as by xStreamBufferSendFromISR().
+ *
+ * @return The number of bytes committed.
+ *
+ * \defgroup xStreamBufferCommitWrite xStreamBufferCommitWrite
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+    size_t xStreamBufferCommitWrite( StreamBufferHandle_t xStreamBuffer,
+                                     size_t xBytesWritten ) PRIVILEGED_FUNCTION;
+    size_t xStreamBufferCommitWriteFromISR( StreamBufferHandle_t xStreamBuffer,
+                                            size_t xBytesWritten,
+                                            BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferGetReadWindow( StreamBufferHandle_t xStreamBuffer,
+ *                                    StreamBufferWindow_t * const pxWindow,
+ *                                    TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Describes the data held in a stream buffer so the reader, or a DMA engine
+ * working on the reader's behalf, can use it where it lies instead of having
+ * xStreamBufferReceive() copy it out.  The data stays in the buffer until
+ * xStreamBufferCommitRead() is called.
+ *
+ * The data is returned as one or, if it wraps past the end of the storage
+ * area, two contiguous regions in *pxWindow.  As with xStreamBufferReceive(),
+ * only one task or interrupt may read from a stream buffer, and it must not
+ * call xStreamBufferReceive() while it holds a window.
+ *
+ * For a message buffer the window holds exactly the next message.
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xStreamBufferGetReadWindow() to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer being read from.
+ *
+ * @param pxWindow Set to describe the data.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should
+ * remain in the Blocked state to wait for data to become available if the
+ * stream buffer is empty, or holds no more than the trigger level of a
+ * batching buffer.  Must be 0 when called from an interrupt service routine.
+ *
+ * @return The number of bytes that can be read, which is the sum of the two
+ * region lengths.
+ *
+ * Example use:
+ * @code{c}
+ * void vLogTask( void * pvParameters )
+ * {
+ * StreamBufferWindow_t xWindow;
+ *
+ *  for( ;; )
+ *  {
+ *      if( xStreamBufferGetReadWindow( xLogStream, &xWindow, portMAX_DELAY ) > 0 )
+ *      {
+ *          vUARTWrite( xWindow.pucFirst, xWindow.xFirstLength );
+ *          vUARTWrite( xWindow.pucSecond, xWindow.xSecondLength );
+ *          xStreamBufferCommitRead( xLogStream, xWindow.xFirstLength + xWindow.xSecondLength );
+ *      }
+ *  }
+ * }
+ * @endcode
+ * \defgroup xStreamBufferGetReadWindow xStreamBufferGetReadWindow
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+    size_t xStreamBufferGetReadWindow( StreamBufferHandle_t xStreamBuffer,
+                                       StreamBufferWindow_t * const pxWindow,
+                                       TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferCommitRead( StreamBufferHandle_t xStreamBuffer,
+ *                                 size_t xBytesRead );
+ * size_t xStreamBufferCommitReadFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                        size_t xBytesRead,
+ *                                        BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Removes the first xBytesRead bytes of the window returned by
+ * xStreamBufferGetReadWindow() from the stream buffer, unblocking a task
+ * waiting to send just as xStreamBufferReceive() and
+ * xStreamBufferReceiveFromISR() do.  A message buffer always removes the
+ * whole message, so xBytesRead can be anything up to the message length.
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * these functions to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer being read from.
+ *
+ * @param xBytesRead The number of bytes consumed from the window.
+ *
+ * @param pxHigherPriorityTaskWoken Used as by xStreamBufferReceiveFromISR().
+ *
+ * @return The number of bytes removed, which for a message buffer is the
+ * length of the message.
+ *
+ * \defgroup xStreamBufferCommitRead xStreamBufferCommitRead
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+    size_t xStreamBufferCommitRead( StreamBufferHandle_t xStreamBuffer,
+                                    size_t xBytesRead ) PRIVILEGED_FUNCTION;
+    size_t xStreamBufferCommitReadFromISR( StreamBufferHandle_t xStreamBuffer,
+                                           size_t xBytesRead,
+                                           BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * stream_buffer.h
  *
@@ -3580,6 +3580,46 @@ BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList ) PRIVILEG
 void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
                                         const TickType_t xItemValue ) PRIVILEGED_FUNCTION;
 
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS USED BY THE
+ * EVENT GROUP MODULE TO UNBLOCK TASKS DIRECTLY FROM AN INTERRUPT.
+ *
+ * An interrupt safe version of vTaskRemoveFromUnorderedEventList().  It must be
+ * called from a critical section, and only while no task can be accessing the
+ * unordered event list that holds pxEventListItem.
+ *
+ * @return pdTRUE if a context switch should be requested before the interrupt
+ * exits, otherwise pdFALSE.
+ */
+#if ( configUSE_EVENT_GROUP_DIRECT_ISR_SET == 1 )
+    BaseType_t xTaskRemoveFromUnorderedEventListFromISR( ListItem_t * pxEventListItem,
+                                                         const TickType_t xItemValue ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE USED BY
+ * THE QUEUE MODULE TO HAND AN ITEM DIRECTLY TO A BLOCKED RECEIVER.
+ *
+ * vTaskSetQueueHandOffBuffer() records the buffer into which the calling task
+ * wants the next item copied.  It must be called with the scheduler suspended,
+ * just before the task places itself on a queue's xTasksWaitingToReceive list.
+ *
+ * pvTaskTakeQueueHandOffBuffer() MUST BE CALLED FROM A CRITICAL SECTION.  It
+ * returns the buffer recorded by the highest priority task on pxEventList, or
+ * NULL if that task did not record one, and clears it so the buffer is only
+ * written once.  The caller must copy the item and then remove the task with
+ * xTaskRemoveFromEventList() before leaving the critical section.
+ *
+ * xTaskResetQueueHandOffBuffer() is called by the receiver once it runs again.
+ * It returns pdTRUE if a sender consumed the buffer, in which case the item has
+ * already been delivered, otherwise it clears the buffer and returns pdFALSE.
+ */
+#if ( configUSE_QUEUE_HAND_OFF == 1 )
+    void vTaskSetQueueHandOffBuffer( void * pvBuffer ) PRIVILEGED_FUNCTION;
+    void * pvTaskTakeQueueHandOffBuffer( const List_t * const pxEventList ) PRIVILEGED_FUNCTION;
+    BaseType_t xTaskResetQueueHandOffBuffer( void ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS ONLY
  * INTENDED FOR USE WHEN IMPLEMENTING A PORT OF THE SCHEDULER AND IS
@@ -0,0 +1,417 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "memory_pool.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include memory pool functionality. This #if is closed at the very bottom
+ * of this file. If you want to include memory pools then ensure
+ * configUSE_MEMORY_POOLS is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_MEMORY_POOLS == 1 )
+
+/* A free block holds a pointer to the next free block in its first bytes. */
+    typedef struct MemoryPoolBlockLink
+    {
+        struct MemoryPoolBlockLink * pxNextFreeBlock;
+    } MemoryPoolBlockLink_t;
+
+    typedef struct MemoryPoolDef_t
+    {
+        MemoryPoolBlockLink_t * pxFreeListHead; /**< The next block pvMemoryPoolAlloc() will return, or NULL if the pool is exhausted. */
+        uint8_t * pucStorageStart;              /**< First byte of the storage area, used to validate blocks being freed. */
+        uint8_t * pucStorageEnd;                /**< One past the last byte of the storage area. */
+        size_t xBlockSize;                      /**< Size of each block, already rounded by memorypoolBLOCK_SIZE(). */
+        UBaseType_t uxBlockCount;
+        UBaseType_t uxFreeBlocks;
+        UBaseType_t uxMinimumEverFreeBlocks;
+    } MemoryPool_t;
+
+/*-----------------------------------------------------------*/
+
+/* Pools registered with xMemoryPoolAddSizeClass(), ordered by ascending block
+ * size so the first pool that fits a request is also the tightest fit. */
+    PRIVILEGED_DATA static MemoryPool_t * pxSizeClasses[ configMEMORY_POOL_MAX_SIZE_CLASSES ];
+    PRIVILEGED_DATA static UBaseType_t uxSizeClassCount = 0U;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Returns pdTRUE if pvBlock lies within the storage area of pxPool.
+ */
+    static BaseType_t prvIsBlockInPool( const MemoryPool_t * pxPool,
+                                        const void * pvBlock ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    MemoryPoolHandle_t xMemoryPoolCreateStatic( size_t xBlockSize,
+                                                UBaseType_t uxBlockCount,
+                                                uint8_t * pucPoolStorageBuffer,
+                                                StaticMemoryPool_t * pxStaticMemoryPool )
+    {
+        MemoryPool_t * pxPool = NULL;
+        MemoryPoolBlockLink_t * pxBlock;
+        UBaseType_t uxBlock;
+        size_t xActualBlockSize;
+
+        traceENTER_xMemoryPoolCreateStatic( xBlockSize, uxBlockCount, pucPoolStorageBuffer, pxStaticMemoryPool );
+
+        configASSERT( pucPoolStorageBuffer );
+        configASSERT( pxStaticMemoryPool );
+        configASSERT( uxBlockCount > 0U );
+        configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pucPoolStorageBuffer ) & ( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) == 0U );
+
+        #if ( configASSERT_DEFINED == 1 )
+        {
+            /* Sanity check that the size of the structure used to declare a
+             * variable of type StaticMemoryPool_t equals the size of the real
+             * memory pool structure. */
+            volatile size_t xSize = sizeof( StaticMemoryPool_t );
+            configASSERT( xSize == sizeof( MemoryPool_t ) );
+        }
+        #endif /* configASSERT_DEFINED */
+
+        if( ( pucPoolStorageBuffer != NULL ) && ( pxStaticMemoryPool != NULL ) )
+        {
+            xActualBlockSize = memorypoolBLOCK_SIZE( xBlockSize );
+
+            /* MISRA Ref 11.3.1 [Misaligned access] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+            /* coverity[misra_c_2012_rule_11_3_violation] */
+            pxPool = ( MemoryPool_t * ) pxStaticMemoryPool;
+            pxPool->pucStorageStart = pucPoolStorageBuffer;
+            pxPool->pucStorageEnd = pucPoolStorageBuffer + ( xActualBlockSize * ( size_t ) uxBlockCount );
+            pxPool->xBlockSize = xActualBlockSize;
+            pxPool->uxBlockCount = uxBlockCount;
+            pxPool->uxFreeBlocks = uxBlockCount;
+            pxPool->uxMinimumEverFreeBlocks = uxBlockCount;
+
+            /* Thread the free list through the blocks in address order. */
+            pxPool->pxFreeListHead = NULL;
+
+            for( uxBlock = uxBlockCount; uxBlock > 0U; uxBlock-- )
+            {
+                /* MISRA Ref 11.3.1 [Misaligned access] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+                /* coverity[misra_c_2012_rule_11_3_violation] */
+                pxBlock = ( MemoryPoolBlockLink_t * ) ( pucPoolStorageBuffer + ( xActualBlockSize * ( size_t ) ( uxBlock - 1U ) ) );
+                pxBlock->pxNextFreeBlock = pxPool->pxFreeListHead;
+                pxPool->pxFreeListHead = pxBlock;
+            }
+        }
+
+        traceRETURN_xMemoryPoolCreateStatic( pxPool );
+
+        return pxPool;
+    }
+/*-----------------------------------------------------------*/
+
+    void * pvMemoryPoolAlloc( MemoryPoolHandle_t xMemoryPool )
+    {
+        MemoryPool_t * const pxPool = xMemoryPool;
+        MemoryPoolBlockLink_t * pxBlock;
+        UBaseType_t uxSavedInterruptStatus;
+
+        traceENTER_pvMemoryPoolAlloc( xMemoryPool );
+
+        configASSERT( pxPool );
+
+        /* Only the head of the free list is touched, so the interrupt mask is
+         * held for a handful of instructions regardless of the pool size. */
+        uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+        {
+            pxBlock = pxPool->pxFreeListHead;
+
+            if( pxBlock != NULL )
+            {
+                pxPool->pxFreeListHead = pxBlock->pxNextFreeBlock;
+                pxPool->uxFreeBlocks--;
+
+                if( pxPool->uxFreeBlocks < pxPool->uxMinimumEverFreeBlocks )
+                {
+                    pxPool->uxMinimumEverFreeBlocks = pxPool->uxFreeBlocks;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        traceRETURN_pvMemoryPoolAlloc( pxBlock );
+
+        return pxBlock;
+    }
+/*-----------------------------------------------------------*/
+
+    void vMemoryPoolFree( MemoryPoolHandle_t xMemoryPool,
+                          void * pvBlock )
+    {
+        MemoryPool_t * const pxPool = xMemoryPool;
+        MemoryPoolBlockLink_t * pxBlock;
+        UBaseType_t uxSavedInterruptStatus;
+
+        traceENTER_vMemoryPoolFree( xMemoryPool, pvBlock );
+
+        configASSERT( pxPool );
+
+        if( pvBlock != NULL )
+        {
+            /* The block must have come from this pool and must be the start of
+             * a block, not a pointer into the middle of one. */
+            configASSERT( prvIsBlockInPool( pxPool, pvBlock ) != pdFALSE );
+            configASSERT( ( ( size_t ) ( ( uint8_t * ) pvBlock - pxPool->pucStorageStart ) % pxPool->xBlockSize ) == 0U );
+
+            pxBlock = ( MemoryPoolBlockLink_t * ) pvBlock;
+
+            uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+            {
+                configASSERT( pxPool->uxFreeBlocks < pxPool->uxBlockCount );
+
+                pxBlock->pxNextFreeBlock = pxPool->pxFreeListHead;
+                pxPool->pxFreeListHead = pxBlock;
+                pxPool->uxFreeBlocks++;
+            }
+            taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_vMemoryPoolFree();
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xMemoryPoolAddSizeClass( MemoryPoolHandle_t xMemoryPool )
+    {
+        MemoryPool_t * const pxPool = xMemoryPool;
+        BaseType_t xReturn = pdFAIL;
+        UBaseType_t uxIndex;
+
+        traceENTER_xMemoryPoolAddSizeClass( xMemoryPool );
+
+        configASSERT( pxPool );
+
+        taskENTER_CRITICAL();
+        {
+            if( uxSizeClassCount < ( UBaseType_t ) configMEMORY_POOL_MAX_SIZE_CLASSES )
+            {
+                /* Insertion sort on block size - the table is tiny and only
+                 * changes during initialisation. */
+                uxIndex = uxSizeClassCount;
+
+                while( ( uxIndex > 0U ) && ( pxSizeClasses[ uxIndex - 1U ]->xBlockSize > pxPool->xBlockSize ) )
+                {
+                    pxSizeClasses[ uxIndex ] = pxSizeClasses[ uxIndex - 1U ];
+                    uxIndex--;
+                }
+
+                pxSizeClasses[ uxIndex ] = pxPool;
+                uxSizeClassCount++;
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_xMemoryPoolAddSizeClass( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void * pvMemoryPoolAllocFromSizeClass( size_t xWantedSize )
+    {
+        void * pvReturn = NULL;
+        UBaseType_t uxIndex;
+
+        traceENTER_pvMemoryPoolAllocFromSizeClass( xWantedSize );
+
+        for( uxIndex = 0U; uxIndex < uxSizeClassCount; uxIndex++ )
+        {
+            if( pxSizeClasses[ uxIndex ]->xBlockSize >= xWantedSize )
+            {
+                /* Fall through to the next larger class if this one is
+                 * exhausted. */
+                pvReturn = pvMemoryPoolAlloc( pxSizeClasses[ uxIndex ] );
+
+                if( pvReturn != NULL )
+                {
+                    break;
+                }
+            }
+        }
+
+        traceRETURN_pvMemoryPoolAllocFromSizeClass( pvReturn );
+
+        return pvReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xMemoryPoolFreeToSizeClass( void * pvBlock )
+    {
+        BaseType_t xReturn = pdFALSE;
+        UBaseType_t uxIndex;
+
+        traceENTER_xMemoryPoolFreeToSizeClass( pvBlock );
+
+        for( uxIndex = 0U; uxIndex < uxSizeClassCount; uxIndex++ )
+        {
+            if( prvIsBlockInPool( pxSizeClasses[ uxIndex ], pvBlock ) != pdFALSE )
+            {
+                vMemoryPoolFree( pxSizeClasses[ uxIndex ], pvBlock );
+                xReturn = pdTRUE;
+                break;
+            }
+        }
+
+        traceRETURN_xMemoryPoolFreeToSizeClass( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxMemoryPoolGetFreeBlockCount( MemoryPoolHandle_t xMemoryPool )
+    {
+        configASSERT( xMemoryPool );
+
+        return xMemoryPool->uxFreeBlocks;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxMemoryPoolGetMinimumEverFreeBlockCount( MemoryPoolHandle_t xMemoryPool )
+    {
+        configASSERT( xMemoryPool );
+
+        return xMemoryPool->uxMinimumEverFreeBlocks;
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xMemoryPoolGetBlockSize( MemoryPoolHandle_t xMemoryPool )
+    {
+        configASSERT( xMemoryPool );
+
+        return xMemoryPool->xBlockSize;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvIsBlockInPool( const MemoryPool_t * pxPool,
+                                        const void * pvBlock )
+    {
+        BaseType_t xReturn;
+        const uint8_t * pucBlock = ( const uint8_t * ) pvBlock;
+
+        if( ( pucBlock >= pxPool->pucStorageStart ) && ( pucBlock < pxPool->pucStorageEnd ) )
+        {
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configKERNEL_OBJECTS_FROM_MEMORY_POOLS == 1 )
+
+        #if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+            #error configKERNEL_OBJECTS_FROM_MEMORY_POOLS requires configSUPPORT_DYNAMIC_ALLOCATION to be set to 1
+        #endif
+
+        void * pvPortMallocKernelObject( size_t xSize )
+        {
+            void * pvReturn;
+
+            pvReturn = pvMemoryPoolAllocFromSizeClass( xSize );
+
+            if( pvReturn == NULL )
+            {
+                /* No size class can hold the object, or they are all
+                 * exhausted - use the heap instead. */
+                pvReturn = pvPortMalloc( xSize );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            return pvReturn;
+        }
+/*-----------------------------------------------------------*/
+
+        void vPortFreeKernelObject( void * pv )
+        {
+            if( pv != NULL )
+            {
+                if( xMemoryPoolFreeToSizeClass( pv ) == pdFALSE )
+                {
+                    vPortFree( pv );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+    #endif /* configKERNEL_OBJECTS_FROM_MEMORY_POOLS */
+
+/* This entire source file will be skipped if the application is not configured
+ * to include memory pool functionality. If you want to include memory pools
+ * then ensure configUSE_MEMORY_POOLS is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_MEMORY_POOLS == 1 */
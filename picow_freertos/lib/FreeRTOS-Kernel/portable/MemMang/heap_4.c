@@ -55,6 +55,24 @@
     #define configHEAP_CLEAR_MEMORY_ON_FREE    0
 #endif
 
+#if ( configHEAP_TRACE_ALLOCATIONS == 1 )
+    #if ( ( INCLUDE_xTaskGetSchedulerState == 0 ) && ( configUSE_TIMERS == 0 ) )
+        #error configHEAP_TRACE_ALLOCATIONS requires INCLUDE_xTaskGetSchedulerState or configUSE_TIMERS to be set to 1
+    #endif
+
+/* The time base used to stamp heap trace records.  Can be mapped to a free
+ * running hardware counter for sub tick resolution. */
+    #ifndef configHEAP_TRACE_GET_TIMESTAMP
+        #define configHEAP_TRACE_GET_TIMESTAMP()    ( ( uint32_t ) xTaskGetTickCount() )
+    #endif
+
+    #if defined( __GNUC__ )
+        #define heapGET_CALLER_ADDRESS()    __builtin_return_address( 0 )
+    #else
+        #define heapGET_CALLER_ADDRESS()    NULL
+    #endif
+#endif /* configHEAP_TRACE_ALLOCATIONS */
+
 /* Block sizes must not get too small. */
 #define heapMINIMUM_BLOCK_SIZE    ( ( size_t ) ( xHeapStructSize << 1 ) )
 
@@ -151,6 +169,20 @@ static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) PRIVILEG
  */
 static void prvHeapInit( void ) PRIVILEGED_FUNCTION;
 
+#if ( configHEAP_TRACE_ALLOCATIONS == 1 )
+
+/*
+ * Appends an event to the heap trace buffer, overwriting the oldest record once
+ * the buffer is full.  Must be called with the scheduler suspended.
+ */
+    static void prvHeapTraceRecord( uint8_t ucEvent,
+                                    void * pvAddress,
+                                    size_t xRequestedSize,
+                                    size_t xBlockSize,
+                                    void * pvCaller ) PRIVILEGED_FUNCTION;
+
+#endif /* configHEAP_TRACE_ALLOCATIONS */
+
 /*-----------------------------------------------------------*/
 
 /* The size of the structure placed at the beginning of each allocated memory
@@ -168,6 +200,12 @@ PRIVILEGED_DATA static size_t xMinimumEverFreeBytesRemaining = ( size_t ) 0U;
 PRIVILEGED_DATA static size_t xNumberOfSuccessfulAllocations = ( size_t ) 0U;
 PRIVILEGED_DATA static size_t xNumberOfSuccessfulFrees = ( size_t ) 0U;
 
+#if ( configHEAP_TRACE_ALLOCATIONS == 1 )
+    PRIVILEGED_DATA static HeapTraceRecord_t xHeapTraceRecords[ configHEAP_TRACE_BUFFER_LENGTH ];
+    PRIVILEGED_DATA static size_t xHeapTraceEventCount = ( size_t ) 0U;
+    PRIVILEGED_DATA static size_t xHeapTraceNextRecord = ( size_t ) 0U;
+#endif
+
 /*-----------------------------------------------------------*/
 
 void * pvPortMalloc( size_t xWantedSize )
@@ -179,6 +217,11 @@ void * pvPortMalloc( size_t xWantedSize )
     size_t xAdditionalRequiredSize;
     size_t xAllocatedBlockSize = 0;
 
+    #if ( configHEAP_TRACE_ALLOCATIONS == 1 )
+        const size_t xRequestedSize = xWantedSize;
+        void * const pvCaller = heapGET_CALLER_ADDRESS();
+    #endif
+
     if( xWantedSize > 0 )
     {
         /* The wanted size must be increased so it can contain a BlockLink_t
@@ -328,6 +371,13 @@ void * pvPortMalloc( size_t xWantedSize )
 
         traceMALLOC( pvReturn, xAllocatedBlockSize );
 
+        #if ( configHEAP_TRACE_ALLOCATIONS == 1 )
+        {
+            prvHeapTraceRecord( ( pvReturn != NULL ) ? heapTRACE_EVENT_MALLOC : heapTRACE_EVENT_MALLOC_FAILED,
+                                pvReturn, xRequestedSize, xAllocatedBlockSize, pvCaller );
+        }
+        #endif
+
         /* Prevent compiler warnings when trace macros are not used. */
         ( void ) xAllocatedBlockSize;
     }
@@ -392,6 +442,13 @@ void vPortFree( void * pv )
                     /* Add this block to the list of free blocks. */
                     xFreeBytesRemaining += pxLink->xBlockSize;
                     traceFREE( pv, pxLink->xBlockSize );
+
+                    #if ( configHEAP_TRACE_ALLOCATIONS == 1 )
+                    {
+                        prvHeapTraceRecord( heapTRACE_EVENT_FREE, pv, 0U, pxLink->xBlockSize, heapGET_CALLER_ADDRESS() );
+                    }
+                    #endif
+
                     prvInsertBlockIntoFreeList( ( ( BlockLink_t * ) pxLink ) );
                     xNumberOfSuccessfulFrees++;
                 }
@@ -634,5 +691,135 @@ void vPortHeapResetState( void )
     xMinimumEverFreeBytesRemaining = ( size_t ) 0U;
     xNumberOfSuccessfulAllocations = ( size_t ) 0U;
     xNumberOfSuccessfulFrees = ( size_t ) 0U;
+
+    #if ( configHEAP_TRACE_ALLOCATIONS == 1 )
+    {
+        xHeapTraceEventCount = ( size_t ) 0U;
+        xHeapTraceNextRecord = ( size_t ) 0U;
+    }
+    #endif
 }
 /*-----------------------------------------------------------*/
+
+#if ( configHEAP_TRACE_ALLOCATIONS == 1 )
+
+    static void prvHeapTraceRecord( uint8_t ucEvent,
+                                    void * pvAddress,
+                                    size_t xRequestedSize,
+                                    size_t xBlockSize,
+                                    void * pvCaller ) /* PRIVILEGED_FUNCTION */
+    {
+        HeapTraceRecord_t * pxRecord;
+
+        pxRecord = &( xHeapTraceRecords[ xHeapTraceNextRecord ] );
+        pxRecord->pvAddress = pvAddress;
+        pxRecord->xRequestedSize = xRequestedSize;
+        pxRecord->xBlockSize = xBlockSize;
+        pxRecord->pvCaller = pvCaller;
+        pxRecord->pvTask = ( xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED ) ? ( void * ) xTaskGetCurrentTaskHandle() : NULL;
+        pxRecord->ulTimestamp = configHEAP_TRACE_GET_TIMESTAMP();
+        pxRecord->ucEvent = ucEvent;
+
+        xHeapTraceEventCount++;
+        xHeapTraceNextRecord++;
+
+        if( xHeapTraceNextRecord == ( size_t ) configHEAP_TRACE_BUFFER_LENGTH )
+        {
+            xHeapTraceNextRecord = 0U;
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxPortGetHeapTraceRecords( HeapTraceRecord_t * pxRecords,
+                                           UBaseType_t uxMaxRecords )
+    {
+        size_t xAvailable, xIndex;
+        UBaseType_t uxCopied = 0U;
+
+        configASSERT( ( pxRecords != NULL ) || ( uxMaxRecords == 0U ) );
+
+        vTaskSuspendAll();
+        {
+            /* Only the last configHEAP_TRACE_BUFFER_LENGTH events are still
+             * held, and the caller may only want the most recent of those. */
+            xAvailable = ( xHeapTraceEventCount > ( size_t ) configHEAP_TRACE_BUFFER_LENGTH ) ? ( size_t ) configHEAP_TRACE_BUFFER_LENGTH : xHeapTraceEventCount;
+
+            if( xAvailable > ( size_t ) uxMaxRecords )
+            {
+                xAvailable = ( size_t ) uxMaxRecords;
+            }
+
+            /* Step back from the next write position to the oldest record to
+             * be copied. */
+            if( xHeapTraceNextRecord >= xAvailable )
+            {
+                xIndex = xHeapTraceNextRecord - xAvailable;
+            }
+            else
+            {
+                xIndex = ( ( size_t ) configHEAP_TRACE_BUFFER_LENGTH - xAvailable ) + xHeapTraceNextRecord;
+            }
+
+            while( ( size_t ) uxCopied < xAvailable )
+            {
+                pxRecords[ uxCopied ] = xHeapTraceRecords[ xIndex ];
+                uxCopied++;
+                xIndex++;
+
+                if( xIndex == ( size_t ) configHEAP_TRACE_BUFFER_LENGTH )
+                {
+                    xIndex = 0U;
+                }
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        return uxCopied;
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xPortGetHeapTraceEventCount( void )
+    {
+        return xHeapTraceEventCount;
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortGetHeapFreeBlockHistogram( HeapFreeBlockHistogram_t * pxHistogram )
+    {
+        BlockLink_t * pxBlock;
+        size_t xBucket, xSize;
+
+        configASSERT( pxHistogram );
+
+        ( void ) memset( pxHistogram, 0, sizeof( HeapFreeBlockHistogram_t ) );
+
+        vTaskSuspendAll();
+        {
+            pxBlock = heapPROTECT_BLOCK_POINTER( xStart.pxNextFreeBlock );
+
+            /* pxBlock will be NULL if the heap has not been initialised. */
+            if( pxBlock != NULL )
+            {
+                while( pxBlock != pxEnd )
+                {
+                    /* Find floor( log2( size ) ) - 4 with shifts, as the
+                     * Cortex-M0+ has no count leading zeros instruction. */
+                    xBucket = 0U;
+
+                    for( xSize = pxBlock->xBlockSize >> 5; ( xSize != 0U ) && ( xBucket < ( size_t ) ( configHEAP_FREE_BLOCK_HISTOGRAM_BUCKETS - 1 ) ); xSize >>= 1 )
+                    {
+                        xBucket++;
+                    }
+
+                    pxHistogram->xNumberOfFreeBlocks[ xBucket ]++;
+                    pxHistogram->xFreeBytes[ xBucket ] += pxBlock->xBlockSize;
+
+                    pxBlock = heapPROTECT_BLOCK_POINTER( pxBlock->pxNextFreeBlock );
+                }
+            }
+        }
+        ( void ) xTaskResumeAll();
+    }
+/*-----------------------------------------------------------*/
+
+#endif /* configHEAP_TRACE_ALLOCATIONS */
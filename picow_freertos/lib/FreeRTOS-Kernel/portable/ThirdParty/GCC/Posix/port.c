@@ -40,6 +40,23 @@
 * The timer interrupt uses SIGALRM and care is taken to ensure that
 * the signal handler runs only on the thread for the current task.
 *
+* With configPOSIX_USE_FUTEX_SWITCH set to 1 (Linux only) threads are
+* instead suspended on a futex of their own, and interrupts are masked
+* with a flag rather than with pthread_sigmask().  A tick that arrives
+* while the flag is set is held pending and handled as soon as the flag
+* is cleared, so a critical section no longer costs two system calls
+* and a context switch costs one wake and one wait.  The tick thread
+* also sleeps to absolute deadlines so the tick does not drift.
+*
+* With configNUMBER_OF_CORES greater than 1 (which requires
+* configPOSIX_USE_FUTEX_SWITCH) the thread of the current task of each
+* simulated core runs at the same time as the others.  Each core has its
+* own interrupt mask flag and pending yield request, and SIGALRM is
+* also used to ring the current thread of a core when another core
+* requests it to yield.  The kernel's spin locks are recursive locks on
+* host atomics.  Only configTICK_CORE handles the tick, and
+* vTaskEndScheduler() is not supported.
+*
 * Use of part of the standard C library requires care as some
 * functions can take pthread mutexes internally which can result in
 * deadlocks as the FreeRTOS kernel can switch tasks while they're
@@ -57,10 +74,10 @@
 #ifdef __linux__
     #define _GNU_SOURCE
 #endif
-#include "portmacro.h"
 #include <errno.h>
 #include <pthread.h>
 #include <limits.h>
+#include <sched.h>
 #include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -77,6 +94,29 @@
 #include "utils/wait_for_event.h"
 /*-----------------------------------------------------------*/
 
+#ifndef configPOSIX_USE_FUTEX_SWITCH
+    #define configPOSIX_USE_FUTEX_SWITCH    0
+#endif
+
+#if ( configPOSIX_USE_FUTEX_SWITCH == 1 )
+    #ifndef __linux__
+        #error configPOSIX_USE_FUTEX_SWITCH is only supported on Linux
+    #endif
+
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+#endif
+
+#if ( configNUMBER_OF_CORES > 1 )
+    #if ( configPOSIX_USE_FUTEX_SWITCH != 1 )
+        #error configNUMBER_OF_CORES greater than 1 requires configPOSIX_USE_FUTEX_SWITCH to be set to 1
+    #endif
+
+    #ifndef configTICK_CORE
+        #define configTICK_CORE    0
+    #endif
+#endif
+
 #define SIG_RESUME    SIGUSR1
 
 typedef struct THREAD
@@ -85,7 +125,14 @@ typedef struct THREAD
     TaskFunction_t pxCode;
     void * pvParams;
     BaseType_t xDying;
-    struct event * ev;
+    #if ( configNUMBER_OF_CORES > 1 )
+        BaseType_t xCoreID; /* The core the thread runs for once resumed. */
+    #endif
+    #if ( configPOSIX_USE_FUTEX_SWITCH == 1 )
+        uint32_t ulResume; /* Set to 1 to resume the thread, which clears it again. */
+    #else
+        struct event * ev;
+    #endif
 } Thread_t;
 
 /*
@@ -112,6 +159,25 @@ static pthread_t hTimerTickThread;
 static bool xTimerTickThreadShouldRun;
 static uint64_t prvStartTimeNs;
 static pthread_key_t xThreadKey = 0;
+
+#if ( configNUMBER_OF_CORES > 1 )
+    static BaseType_t xInterruptsMasked[ configNUMBER_OF_CORES ];
+    static uint32_t ulPendingYields[ configNUMBER_OF_CORES ];
+    static int32_t lLockOwner[ portRTOS_SPINLOCK_COUNT ] = { -1, -1 };
+    static uint32_t ulLockRecursion[ portRTOS_SPINLOCK_COUNT ];
+
+/* Thread local state.  xThreadMasking is set while the thread masks its core,
+ * so that the signal handler cannot move it to another core in between. */
+    static __thread volatile BaseType_t xThreadCoreID = 0;
+    static __thread volatile BaseType_t xThreadInISR = pdFALSE;
+    static __thread volatile BaseType_t xThreadMasking = pdFALSE;
+#elif ( configPOSIX_USE_FUTEX_SWITCH == 1 )
+    static BaseType_t xInterruptsMasked = pdTRUE;
+#endif
+
+#if ( configPOSIX_USE_FUTEX_SWITCH == 1 )
+    static uint32_t ulPendingTicks = 0;
+#endif
 /*-----------------------------------------------------------*/
 
 static void prvSetupSignalsAndSchedulerPolicy( void );
@@ -129,6 +195,19 @@ static void prvInitThreadKey( void );
 static void prvMarkAsFreeRTOSThread( void );
 static BaseType_t prvIsFreeRTOSThread( void );
 static void prvDestroyThreadKey( void );
+static void prvThreadWait( Thread_t * pxThread );
+static void prvThreadSignal( Thread_t * pxThread );
+
+#if ( configNUMBER_OF_CORES == 1 )
+    static void prvProcessTick( void );
+#endif
+
+#if ( configNUMBER_OF_CORES > 1 )
+    static BaseType_t prvMaskCore( BaseType_t * pxCoreID );
+    static void prvProcessPendingInterrupts( void );
+#elif ( configPOSIX_USE_FUTEX_SWITCH == 1 )
+    static void prvProcessPendingTicks( void );
+#endif
 /*-----------------------------------------------------------*/
 
 static void prvThreadKeyDestructor( void * pvData )
@@ -216,6 +295,10 @@ StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
     size_t ulStackSize;
     int iRet;
 
+    #if ( configNUMBER_OF_CORES > 1 )
+        UBaseType_t uxSavedInterruptStatus;
+    #endif
+
     ( void ) pthread_once( &hSigSetupThread, prvSetupSignalsAndSchedulerPolicy );
 
     /*
@@ -234,9 +317,17 @@ StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
 
     pthread_attr_init( &xThreadAttributes );
 
-    thread->ev = event_create();
+    #if ( configPOSIX_USE_FUTEX_SWITCH == 1 )
+        thread->ulResume = 0;
+    #else
+        thread->ev = event_create();
+    #endif
 
-    vPortEnterCritical();
+    #if ( configNUMBER_OF_CORES > 1 )
+        uxSavedInterruptStatus = xPortSetInterruptMask();
+    #else
+        vPortEnterCritical();
+    #endif
 
     iRet = pthread_create( &thread->pthread, &xThreadAttributes,
                            prvWaitForStart, thread );
@@ -246,7 +337,11 @@ StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
         prvFatalError( "pthread_create", iRet );
     }
 
-    vPortExitCritical();
+    #if ( configNUMBER_OF_CORES > 1 )
+        vPortClearInterruptMask( uxSavedInterruptStatus );
+    #else
+        vPortExitCritical();
+    #endif
 
     return pxTopOfStack;
 }
@@ -254,10 +349,27 @@ StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
 
 void vPortStartFirstTask( void )
 {
-    Thread_t * pxFirstThread = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+    #if ( configNUMBER_OF_CORES > 1 )
+    {
+        BaseType_t xCoreID;
+        Thread_t * pxFirstThread;
 
-    /* Start the first task. */
-    prvResumeThread( pxFirstThread );
+        /* Start the first task of every core. */
+        for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+        {
+            pxFirstThread = prvGetThreadFromTask( xTaskGetCurrentTaskHandleForCore( xCoreID ) );
+            pxFirstThread->xCoreID = xCoreID;
+            prvResumeThread( pxFirstThread );
+        }
+    }
+    #else
+    {
+        Thread_t * pxFirstThread = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+        /* Start the first task. */
+        prvResumeThread( pxFirstThread );
+    }
+    #endif
 }
 /*-----------------------------------------------------------*/
 
@@ -272,6 +384,23 @@ BaseType_t xPortStartScheduler( void )
     hMainThread = pthread_self();
     prvPortSetCurrentThreadName( "Scheduler" );
 
+    #if ( configNUMBER_OF_CORES > 1 )
+    {
+        BaseType_t xCoreID;
+
+        for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+        {
+            xInterruptsMasked[ xCoreID ] = pdTRUE;
+            ulPendingYields[ xCoreID ] = 0;
+        }
+
+        ulPendingTicks = 0;
+    }
+    #elif ( configPOSIX_USE_FUTEX_SWITCH == 1 )
+        xInterruptsMasked = pdTRUE;
+        ulPendingTicks = 0;
+    #endif
+
     /* Start the timer that generates the tick ISR(SIGALRM).
      * Interrupts are disabled here already. */
     prvSetupTimerInterrupt();
@@ -326,6 +455,12 @@ void vPortEndScheduler( void )
     Thread_t * pxCurrentThread;
     BaseType_t xIsFreeRTOSThread;
 
+    #if ( configNUMBER_OF_CORES > 1 )
+        /* Tasks on the other cores cannot be stopped, as in the RP2040
+         * port, so ending the scheduler is not supported. */
+        configASSERT( pdFALSE );
+    #endif
+
     /* Stop the timer tick thread. */
     xTimerTickThreadShouldRun = false;
     pthread_join( hTimerTickThread, NULL );
@@ -343,7 +478,7 @@ void vPortEndScheduler( void )
     if( xIsFreeRTOSThread == pdTRUE )
     {
         pxCurrentThread = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
-        event_wait( pxCurrentThread->ev );
+        prvThreadWait( pxCurrentThread );
     }
 
     pthread_testcancel();
@@ -380,7 +515,11 @@ static void prvPortYieldFromISR( void )
 
     xThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
 
-    vTaskSwitchContext();
+    #if ( configNUMBER_OF_CORES > 1 )
+        vTaskSwitchContext( xThreadCoreID );
+    #else
+        vTaskSwitchContext();
+    #endif
 
     xThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
 
@@ -394,11 +533,36 @@ void vPortYield( void )
      * the thread could get stuck in a suspended state. */
     configASSERT( prvIsFreeRTOSThread() == pdTRUE );
 
-    vPortEnterCritical();
+    #if ( configNUMBER_OF_CORES > 1 )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+
+        if( xThreadInISR != pdFALSE )
+        {
+            /* Switched when the interrupt returns. */
+            __atomic_store_n( &ulPendingYields[ xThreadCoreID ], 1U, __ATOMIC_SEQ_CST );
+        }
+        else
+        {
+            /* The critical nesting count is in the TCB, so only interrupts
+             * are masked here.  The thread can resume on another core, whose
+             * mask is then restored. */
+            uxSavedInterruptStatus = xPortSetInterruptMask();
+
+            prvPortYieldFromISR();
+
+            vPortClearInterruptMask( uxSavedInterruptStatus );
+        }
+    }
+    #else
+    {
+        vPortEnterCritical();
 
-    prvPortYieldFromISR();
+        prvPortYieldFromISR();
 
-    vPortExitCritical();
+        vPortExitCritical();
+    }
+    #endif
 }
 /*-----------------------------------------------------------*/
 
@@ -406,7 +570,15 @@ void vPortDisableInterrupts( void )
 {
     if( prvIsFreeRTOSThread() == pdTRUE )
     {
-        pthread_sigmask( SIG_BLOCK, &xAllSignals, NULL );
+        #if ( configNUMBER_OF_CORES > 1 )
+            BaseType_t xCoreID;
+
+            ( void ) prvMaskCore( &xCoreID );
+        #elif ( configPOSIX_USE_FUTEX_SWITCH == 1 )
+            __atomic_store_n( &xInterruptsMasked, pdTRUE, __ATOMIC_SEQ_CST );
+        #else
+            pthread_sigmask( SIG_BLOCK, &xAllSignals, NULL );
+        #endif
     }
 }
 /*-----------------------------------------------------------*/
@@ -415,22 +587,65 @@ void vPortEnableInterrupts( void )
 {
     if( prvIsFreeRTOSThread() == pdTRUE )
     {
-        pthread_sigmask( SIG_UNBLOCK, &xAllSignals, NULL );
+        #if ( configNUMBER_OF_CORES > 1 )
+            __atomic_store_n( &xInterruptsMasked[ xThreadCoreID ], pdFALSE, __ATOMIC_SEQ_CST );
+
+            /* Ticks and yield requests that arrived while this core was
+             * masked are handled now. */
+            prvProcessPendingInterrupts();
+        #elif ( configPOSIX_USE_FUTEX_SWITCH == 1 )
+            __atomic_store_n( &xInterruptsMasked, pdFALSE, __ATOMIC_SEQ_CST );
+
+            /* A tick that arrived while interrupts were masked is handled
+             * now, as unblocking SIGALRM would have done. */
+            prvProcessPendingTicks();
+        #else
+            pthread_sigmask( SIG_UNBLOCK, &xAllSignals, NULL );
+        #endif
     }
 }
 /*-----------------------------------------------------------*/
 
 UBaseType_t xPortSetInterruptMask( void )
 {
-    /* Interrupts are always disabled inside ISRs (signals
-     * handlers). */
-    return ( UBaseType_t ) 0;
+    #if ( configNUMBER_OF_CORES > 1 )
+    {
+        BaseType_t xCoreID;
+        UBaseType_t uxReturn = ( UBaseType_t ) pdTRUE;
+
+        /* Tasks on other cores keep running, so the mask is real and the
+         * previous state is returned. */
+        if( prvIsFreeRTOSThread() == pdTRUE )
+        {
+            uxReturn = ( UBaseType_t ) prvMaskCore( &xCoreID );
+        }
+
+        return uxReturn;
+    }
+    #else
+    {
+        /* Interrupts are always disabled inside ISRs (signals
+         * handlers). */
+        return ( UBaseType_t ) 0;
+    }
+    #endif
 }
 /*-----------------------------------------------------------*/
 
 void vPortClearInterruptMask( UBaseType_t uxMask )
 {
-    ( void ) uxMask;
+    #if ( configNUMBER_OF_CORES > 1 )
+    {
+        if( uxMask == ( UBaseType_t ) pdFALSE )
+        {
+            vPortEnableInterrupts();
+        }
+    }
+    #else
+    {
+        ( void ) uxMask;
+    }
+    #endif
 }
 /*-----------------------------------------------------------*/
 
@@ -456,15 +671,47 @@ static void * prvTimerTickHandler( void * arg )
 
     prvPortSetCurrentThreadName( "Scheduler timer" );
 
+    #if ( configPOSIX_USE_FUTEX_SWITCH == 1 )
+        struct timespec xNextTick;
+
+        clock_gettime( CLOCK_MONOTONIC, &xNextTick );
+    #endif
+
     while( xTimerTickThreadShouldRun )
     {
         /*
          * signal to the active task to cause tick handling or
          * preemption (if enabled)
          */
-        Thread_t * thread = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+        #if ( configNUMBER_OF_CORES > 1 )
+            __atomic_fetch_add( &ulPendingTicks, 1U, __ATOMIC_SEQ_CST );
+
+            Thread_t * thread = prvGetThreadFromTask( xTaskGetCurrentTaskHandleForCore( configTICK_CORE ) );
+        #else
+            Thread_t * thread = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+        #endif
         pthread_kill( thread->pthread, SIGALRM );
-        usleep( portTICK_RATE_MICROSECONDS );
+
+        #if ( configPOSIX_USE_FUTEX_SWITCH == 1 )
+        {
+            xNextTick.tv_nsec += ( long ) portTICK_RATE_MICROSECONDS * 1000L;
+
+            while( xNextTick.tv_nsec >= 1000000000L )
+            {
+                xNextTick.tv_nsec -= 1000000000L;
+                xNextTick.tv_sec++;
+            }
+
+            while( clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &xNextTick, NULL ) == EINTR )
+            {
+                /* Sleep again to the same deadline. */
+            }
+        }
+        #else
+        {
+            usleep( portTICK_RATE_MICROSECONDS );
+        }
+        #endif
     }
 
     return NULL;
@@ -484,17 +731,13 @@ void prvSetupTimerInterrupt( void )
 }
 /*-----------------------------------------------------------*/
 
-static void vPortSystemTickHandler( int sig )
-{
-    if( prvIsFreeRTOSThread() == pdTRUE )
+#if ( configNUMBER_OF_CORES == 1 )
+
+    static void prvProcessTick( void )
     {
         Thread_t * pxThreadToSuspend;
         Thread_t * pxThreadToResume;
 
-        ( void ) sig;
-
-        uxCriticalNesting++; /* Signals are blocked in this signal handler. */
-
         pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
 
         if( xTaskIncrementTick() != pdFALSE )
@@ -506,8 +749,158 @@ static void vPortSystemTickHandler( int sig )
 
             prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
         }
+    }
+
+#endif /* configNUMBER_OF_CORES == 1 */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    static BaseType_t prvMaskCore( BaseType_t * pxCoreID )
+    {
+        BaseType_t xCoreID;
+        BaseType_t xWasMasked;
+
+        /* Until the core is masked the signal handler could switch this
+         * thread out and resume it on another core, so the handler leaves
+         * this thread alone until then. */
+        xThreadMasking = pdTRUE;
+        __atomic_signal_fence( __ATOMIC_SEQ_CST );
+
+        xCoreID = xThreadCoreID;
+        xWasMasked = __atomic_exchange_n( &xInterruptsMasked[ xCoreID ], pdTRUE, __ATOMIC_SEQ_CST );
+
+        __atomic_signal_fence( __ATOMIC_SEQ_CST );
+        xThreadMasking = pdFALSE;
+
+        *pxCoreID = xCoreID;
+
+        return xWasMasked;
+    }
+/*-----------------------------------------------------------*/
 
-        uxCriticalNesting--;
+    static void prvProcessPendingInterrupts( void )
+    {
+        BaseType_t xCoreID;
+        BaseType_t xSwitchRequired;
+        UBaseType_t uxSavedInterruptStatus;
+
+        for( ; ; )
+        {
+            xCoreID = xThreadCoreID;
+
+            if( ( __atomic_load_n( &ulPendingYields[ xCoreID ], __ATOMIC_SEQ_CST ) == 0U ) &&
+                ( ( xCoreID != configTICK_CORE ) ||
+                  ( __atomic_load_n( &ulPendingTicks, __ATOMIC_SEQ_CST ) == 0U ) ) )
+            {
+                break;
+            }
+
+            /* Each pass masks the core, as the signal handler would have run
+             * with signals blocked.  If the core is masked already the work
+             * is left for when it is unmasked. */
+            if( prvMaskCore( &xCoreID ) != pdFALSE )
+            {
+                break;
+            }
+
+            xSwitchRequired = pdFALSE;
+            xThreadInISR = pdTRUE;
+
+            if( ( xCoreID == configTICK_CORE ) &&
+                ( __atomic_load_n( &ulPendingTicks, __ATOMIC_SEQ_CST ) != 0U ) )
+            {
+                __atomic_fetch_sub( &ulPendingTicks, 1U, __ATOMIC_SEQ_CST );
+
+                uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+
+                if( xTaskIncrementTick() != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+
+                taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+            }
+
+            if( __atomic_exchange_n( &ulPendingYields[ xCoreID ], 0U, __ATOMIC_SEQ_CST ) != 0U )
+            {
+                xSwitchRequired = pdTRUE;
+            }
+
+            xThreadInISR = pdFALSE;
+
+            if( xSwitchRequired != pdFALSE )
+            {
+                prvPortYieldFromISR();
+            }
+
+            /* The thread may have been resumed on another core. */
+            __atomic_store_n( &xInterruptsMasked[ xThreadCoreID ], pdFALSE, __ATOMIC_SEQ_CST );
+        }
+    }
+
+#elif ( configPOSIX_USE_FUTEX_SWITCH == 1 )
+
+    static void prvProcessPendingTicks( void )
+    {
+        /* Each pass masks interrupts, as the signal handler would have run
+         * with signals blocked. */
+        while( ( __atomic_load_n( &ulPendingTicks, __ATOMIC_SEQ_CST ) != 0U ) &&
+               ( __atomic_exchange_n( &xInterruptsMasked, pdTRUE, __ATOMIC_SEQ_CST ) == pdFALSE ) )
+        {
+            __atomic_fetch_sub( &ulPendingTicks, 1U, __ATOMIC_SEQ_CST );
+
+            uxCriticalNesting++;
+            prvProcessTick();
+            uxCriticalNesting--;
+
+            __atomic_store_n( &xInterruptsMasked, pdFALSE, __ATOMIC_SEQ_CST );
+        }
+    }
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
+static void vPortSystemTickHandler( int sig )
+{
+    if( prvIsFreeRTOSThread() == pdTRUE )
+    {
+        ( void ) sig;
+
+        #if ( configNUMBER_OF_CORES > 1 )
+        {
+            /* The tick thread counts ticks and other cores count yield
+             * requests before raising SIGALRM, which is only acted upon by the
+             * thread currently running for the core.  The work is otherwise
+             * left for that thread to handle when it unmasks the core. */
+            if( ( xThreadMasking == pdFALSE ) &&
+                ( prvGetThreadFromTask( xTaskGetCurrentTaskHandleForCore( xThreadCoreID ) )->pthread == pthread_self() ) )
+            {
+                prvProcessPendingInterrupts();
+            }
+        }
+        #elif ( configPOSIX_USE_FUTEX_SWITCH == 1 )
+        {
+            /* SIGALRM is not blocked while interrupts are masked, and can
+             * reach a thread that is no longer running the current task, so
+             * the tick is left pending for the running task to handle when it
+             * unmasks interrupts.  Otherwise it is handled here. */
+            __atomic_fetch_add( &ulPendingTicks, 1U, __ATOMIC_SEQ_CST );
+
+            if( prvGetThreadFromTask( xTaskGetCurrentTaskHandle() )->pthread == pthread_self() )
+            {
+                prvProcessPendingTicks();
+            }
+        }
+        #else
+        {
+            uxCriticalNesting++; /* Signals are blocked in this signal handler. */
+
+            prvProcessTick();
+
+            uxCriticalNesting--;
+        }
+        #endif /* configPOSIX_USE_FUTEX_SWITCH */
     }
     else
     {
@@ -516,6 +909,83 @@ static void vPortSystemTickHandler( int sig )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configNUMBER_OF_CORES > 1 )
+
+    BaseType_t xPortGetCoreID( void )
+    {
+        return xThreadCoreID;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xPortCheckIfInISR( void )
+    {
+        return xThreadInISR;
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortYieldCore( BaseType_t xCoreID )
+    {
+        Thread_t * pxThread;
+
+        /* The request stays pending until it is handled, so if the thread
+         * signalled here is no longer running for the core, or the core is
+         * masked, the thread that next unmasks the core yields instead. */
+        __atomic_store_n( &ulPendingYields[ xCoreID ], 1U, __ATOMIC_SEQ_CST );
+
+        pxThread = prvGetThreadFromTask( xTaskGetCurrentTaskHandleForCore( xCoreID ) );
+        pthread_kill( pxThread->pthread, SIGALRM );
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortRecursiveLock( BaseType_t xCoreID,
+                             uint32_t ulLockNum,
+                             BaseType_t uxAcquire )
+    {
+        int32_t lUnowned;
+
+        configASSERT( ulLockNum < portRTOS_SPINLOCK_COUNT );
+
+        if( uxAcquire != pdFALSE )
+        {
+            if( __atomic_load_n( &lLockOwner[ ulLockNum ], __ATOMIC_RELAXED ) == ( int32_t ) xCoreID )
+            {
+                ulLockRecursion[ ulLockNum ]++;
+            }
+            else
+            {
+                for( ; ; )
+                {
+                    lUnowned = -1;
+
+                    if( __atomic_compare_exchange_n( &lLockOwner[ ulLockNum ], &lUnowned, ( int32_t ) xCoreID,
+                                                     false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED ) )
+                    {
+                        break;
+                    }
+
+                    /* The owner's thread may not be scheduled by the host. */
+                    sched_yield();
+                }
+
+                configASSERT( ulLockRecursion[ ulLockNum ] == 0U );
+                ulLockRecursion[ ulLockNum ] = 1U;
+            }
+        }
+        else
+        {
+            configASSERT( __atomic_load_n( &lLockOwner[ ulLockNum ], __ATOMIC_RELAXED ) == ( int32_t ) xCoreID );
+            configASSERT( ulLockRecursion[ ulLockNum ] != 0U );
+
+            if( --ulLockRecursion[ ulLockNum ] == 0U )
+            {
+                __atomic_store_n( &lLockOwner[ ulLockNum ], -1, __ATOMIC_RELEASE );
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+#endif /* configNUMBER_OF_CORES > 1 */
+
 void vPortThreadDying( void * pxTaskToDelete,
                        volatile BaseType_t * pxPendYield )
 {
@@ -535,9 +1005,12 @@ void vPortCancelThread( void * pxTaskToDelete )
      * The thread has already been suspended so it can be safely cancelled.
      */
     pthread_cancel( pxThreadToCancel->pthread );
-    event_signal( pxThreadToCancel->ev );
+    prvThreadSignal( pxThreadToCancel );
     pthread_join( pxThreadToCancel->pthread, NULL );
-    event_delete( pxThreadToCancel->ev );
+
+    #if ( configPOSIX_USE_FUTEX_SWITCH == 0 )
+        event_delete( pxThreadToCancel->ev );
+    #endif
 }
 /*-----------------------------------------------------------*/
 
@@ -550,7 +1023,12 @@ static void * prvWaitForStart( void * pvParams )
     prvSuspendSelf( pxThread );
 
     /* Resumed for the first time, unblocks all signals. */
-    uxCriticalNesting = 0;
+    #if ( configPOSIX_USE_FUTEX_SWITCH == 1 )
+        pthread_sigmask( SIG_UNBLOCK, &xAllSignals, NULL );
+    #endif
+    #if ( configNUMBER_OF_CORES == 1 )
+        uxCriticalNesting = 0;
+    #endif
     vPortEnableInterrupts();
 
     /* Set thread name */
@@ -586,6 +1064,11 @@ static void prvSwitchThread( Thread_t * pxThreadToResume,
          */
         uxSavedCriticalNesting = uxCriticalNesting;
 
+        #if ( configNUMBER_OF_CORES > 1 )
+            /* The resumed thread takes over this core. */
+            pxThreadToResume->xCoreID = xThreadCoreID;
+        #endif
+
         prvResumeThread( pxThreadToResume );
 
         if( pxThreadToSuspend->xDying == pdTRUE )
@@ -614,9 +1097,17 @@ static void prvSuspendSelf( Thread_t * thread )
      * - From a signal handler that has all signals masked.
      *
      * - A thread with all signals blocked with pthread_sigmask().
+     *
+     * With configPOSIX_USE_FUTEX_SWITCH interrupts are masked by the
+     * first two, and a tick that reaches a suspended thread is left
+     * pending for the running task.
      */
-    event_wait( thread->ev );
+    prvThreadWait( thread );
     pthread_testcancel();
+
+    #if ( configNUMBER_OF_CORES > 1 )
+        xThreadCoreID = thread->xCoreID;
+    #endif
 }
 
 /*-----------------------------------------------------------*/
@@ -625,11 +1116,45 @@ static void prvResumeThread( Thread_t * xThreadId )
 {
     if( pthread_self() != xThreadId->pthread )
     {
-        event_signal( xThreadId->ev );
+        prvThreadSignal( xThreadId );
     }
 }
 /*-----------------------------------------------------------*/
 
+static void prvThreadWait( Thread_t * pxThread )
+{
+    #if ( configPOSIX_USE_FUTEX_SWITCH == 1 )
+    {
+        while( __atomic_exchange_n( &pxThread->ulResume, 0U, __ATOMIC_ACQUIRE ) == 0U )
+        {
+            /* Returns at once if the thread was resumed since the exchange,
+             * and on EINTR when a tick signal reaches this thread. */
+            ( void ) syscall( SYS_futex, &pxThread->ulResume, FUTEX_WAIT_PRIVATE, 0U, NULL, NULL, 0 );
+        }
+    }
+    #else
+    {
+        event_wait( pxThread->ev );
+    }
+    #endif
+}
+/*-----------------------------------------------------------*/
+
+static void prvThreadSignal( Thread_t * pxThread )
+{
+    #if ( configPOSIX_USE_FUTEX_SWITCH == 1 )
+    {
+        __atomic_store_n( &pxThread->ulResume, 1U, __ATOMIC_RELEASE );
+        ( void ) syscall( SYS_futex, &pxThread->ulResume, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0 );
+    }
+    #else
+    {
+        event_signal( pxThread->ev );
+    }
+    #endif
+}
+/*-----------------------------------------------------------*/
+
 static void prvSetupSignalsAndSchedulerPolicy( void )
 {
     struct sigaction sigtick;
@@ -102,20 +102,68 @@ extern void vPortYield( void );
 /* Critical section management. */
 extern void vPortDisableInterrupts( void );
 extern void vPortEnableInterrupts( void );
-#define portSET_INTERRUPT_MASK()      ( vPortDisableInterrupts() )
-#define portCLEAR_INTERRUPT_MASK()    ( vPortEnableInterrupts() )
 
 extern UBaseType_t xPortSetInterruptMask( void );
 extern void vPortClearInterruptMask( UBaseType_t xMask );
 
 extern void vPortEnterCritical( void );
 extern void vPortExitCritical( void );
-#define portSET_INTERRUPT_MASK_FROM_ISR()         xPortSetInterruptMask()
-#define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )    vPortClearInterruptMask( x )
-#define portDISABLE_INTERRUPTS()                  portSET_INTERRUPT_MASK()
-#define portENABLE_INTERRUPTS()                   portCLEAR_INTERRUPT_MASK()
-#define portENTER_CRITICAL()                      vPortEnterCritical()
-#define portEXIT_CRITICAL()                       vPortExitCritical()
+
+#if ( configNUMBER_OF_CORES == 1 )
+    #define portSET_INTERRUPT_MASK()                  ( vPortDisableInterrupts() )
+    #define portCLEAR_INTERRUPT_MASK()                ( vPortEnableInterrupts() )
+    #define portSET_INTERRUPT_MASK_FROM_ISR()         xPortSetInterruptMask()
+    #define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )    vPortClearInterruptMask( x )
+    #define portDISABLE_INTERRUPTS()                  portSET_INTERRUPT_MASK()
+    #define portENABLE_INTERRUPTS()                   portCLEAR_INTERRUPT_MASK()
+    #define portENTER_CRITICAL()                      vPortEnterCritical()
+    #define portEXIT_CRITICAL()                       vPortExitCritical()
+#else
+    extern void vTaskEnterCritical( void );
+    extern void vTaskExitCritical( void );
+    extern UBaseType_t vTaskEnterCriticalFromISR( void );
+    extern void vTaskExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus );
+    #define portSET_INTERRUPT_MASK()                  xPortSetInterruptMask()
+    #define portCLEAR_INTERRUPT_MASK( x )             vPortClearInterruptMask( x )
+    #define portSET_INTERRUPT_MASK_FROM_ISR()         xPortSetInterruptMask()
+    #define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )    vPortClearInterruptMask( x )
+    #define portDISABLE_INTERRUPTS()                  vPortDisableInterrupts()
+    #define portENABLE_INTERRUPTS()                   vPortEnableInterrupts()
+    #define portENTER_CRITICAL()                      vTaskEnterCritical()
+    #define portEXIT_CRITICAL()                       vTaskExitCritical()
+    #define portENTER_CRITICAL_FROM_ISR()             vTaskEnterCriticalFromISR()
+    #define portEXIT_CRITICAL_FROM_ISR( x )           vTaskExitCriticalFromISR( x )
+#endif /* if ( configNUMBER_OF_CORES == 1 ) */
+
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+/* Each simulated core runs the thread of its current task concurrently with
+ * the others.  The core a thread is running for is kept in a thread local
+ * variable, and the kernel's spin locks are recursive locks built on host
+ * atomics.  Requires configPOSIX_USE_FUTEX_SWITCH. */
+    extern BaseType_t xPortGetCoreID( void );
+    extern void vPortYieldCore( BaseType_t xCoreID );
+    extern BaseType_t xPortCheckIfInISR( void );
+    extern void vPortRecursiveLock( BaseType_t xCoreID,
+                                    uint32_t ulLockNum,
+                                    BaseType_t uxAcquire );
+
+    #define portGET_CORE_ID()                   xPortGetCoreID()
+    #define portYIELD_CORE( xCoreID )           vPortYieldCore( xCoreID )
+    #define portCHECK_IF_IN_ISR()               xPortCheckIfInISR()
+    #define portASSERT_IF_IN_ISR()              configASSERT( xPortCheckIfInISR() == pdFALSE )
+
+/* The critical nesting count follows the task from core to core. */
+    #define portCRITICAL_NESTING_IN_TCB         1
+
+    #define portRTOS_SPINLOCK_COUNT             2
+    #define portGET_ISR_LOCK( xCoreID )         vPortRecursiveLock( ( xCoreID ), 0, pdTRUE )
+    #define portRELEASE_ISR_LOCK( xCoreID )     vPortRecursiveLock( ( xCoreID ), 0, pdFALSE )
+    #define portGET_TASK_LOCK( xCoreID )        vPortRecursiveLock( ( xCoreID ), 1, pdTRUE )
+    #define portRELEASE_TASK_LOCK( xCoreID )    vPortRecursiveLock( ( xCoreID ), 1, pdFALSE )
+#endif /* configNUMBER_OF_CORES > 1 */
 
 /*-----------------------------------------------------------*/
 
@@ -130,6 +178,9 @@ extern void vPortCancelThread( void * pxTaskToDelete );
 #define portTASK_FUNCTION( vFunction, pvParameters )               void vFunction( void * pvParameters )
 /*-----------------------------------------------------------*/
 
+#define portFORCE_INLINE                                           inline __attribute__( ( always_inline ) )
+/*-----------------------------------------------------------*/
+
 /*
  * Tasks run in their own pthreads and context switches between them
  * are always a full memory barrier. ISRs are emulated as signals
@@ -140,6 +191,13 @@ extern void vPortCancelThread( void * pxTaskToDelete );
  */
 #define portMEMORY_BARRIER()                        __asm volatile ( "" ::: "memory" )
 
+/* With more than one core, tasks on different cores run in parallel
+ * pthreads and exchange data without any context switch in between, so the
+ * data barrier has to be a real fence. */
+#if ( configNUMBER_OF_CORES > 1 )
+    #define portDATA_MEMORY_BARRIER()               __atomic_thread_fence( __ATOMIC_SEQ_CST )
+#endif
+
 extern uint32_t ulPortGetRunTime( void );
 #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()    /* no-op */
 #define portGET_RUN_TIME_COUNTER_VALUE()            ulPortGetRunTime()
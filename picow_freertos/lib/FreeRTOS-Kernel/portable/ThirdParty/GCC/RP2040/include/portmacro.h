@@ -200,6 +200,45 @@ extern void vClearInterruptMaskFromISR( uint32_t ulMask )  __attribute__( ( nake
     #define portEXIT_CRITICAL_FROM_ISR( x )    vTaskExitCriticalFromISR( x )
 #endif /* if ( configNUMBER_OF_CORES == 1 ) */
 
+#if ( configUSE_RP2040_CRITICAL_STATS == 1 )
+
+/* Interrupt masking goes through functions that time each masked period, see
+ * rp2040_critical_stats.h.  They are not inlined, so the return address each
+ * one records is the call site of the macro that called it. */
+    extern uint32_t ulPortCriticalStatsMask( void );
+    extern void vPortCriticalStatsUnmask( uint32_t ulState );
+    extern void vPortCriticalStatsNameSite( void );
+
+    #undef portSET_INTERRUPT_MASK
+    #undef portCLEAR_INTERRUPT_MASK
+    #undef portSET_INTERRUPT_MASK_FROM_ISR
+    #undef portCLEAR_INTERRUPT_MASK_FROM_ISR
+    #undef portDISABLE_INTERRUPTS
+    #undef portENABLE_INTERRUPTS
+    #undef portENTER_CRITICAL
+
+    #define portSET_INTERRUPT_MASK()                  ulPortCriticalStatsMask()
+    #define portCLEAR_INTERRUPT_MASK( ulState )       vPortCriticalStatsUnmask( ulState )
+    #define portSET_INTERRUPT_MASK_FROM_ISR()         ulPortCriticalStatsMask()
+    #define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )    vPortCriticalStatsUnmask( x )
+    #define portDISABLE_INTERRUPTS()                  ( ( void ) ulPortCriticalStatsMask() )
+    #define portENABLE_INTERRUPTS()                   vPortCriticalStatsUnmask( 0 )
+
+/* The masking itself happens inside the kernel's critical section functions,
+ * so the site is named again from the caller of the critical section. */
+    #if ( configNUMBER_OF_CORES == 1 )
+        #define portENTER_CRITICAL()    do { vPortEnterCritical(); vPortCriticalStatsNameSite(); } while( 0 )
+    #else
+        #undef portENTER_CRITICAL_FROM_ISR
+        #define portENTER_CRITICAL()    do { vTaskEnterCritical(); vPortCriticalStatsNameSite(); } while( 0 )
+        #define portENTER_CRITICAL_FROM_ISR()                                \
+    ( {                                                                      \
+        UBaseType_t uxSavedInterruptStatus = vTaskEnterCriticalFromISR(); \
+        vPortCriticalStatsNameSite();                                        \
+        uxSavedInterruptStatus; } )
+    #endif
+#endif /* configUSE_RP2040_CRITICAL_STATS */
+
 #define portRTOS_SPINLOCK_COUNT    2
 
 #if PICO_SDK_VERSION_MAJOR < 2
@@ -270,6 +309,55 @@ static inline void vPortRecursiveLock( BaseType_t xCoreID,
 #endif
 /*-----------------------------------------------------------*/
 
+/* Architecture specific optimisations. */
+#ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
+    #if ( configNUMBER_OF_CORES == 1 )
+        #define configUSE_PORT_OPTIMISED_TASK_SELECTION    1
+    #else
+        #define configUSE_PORT_OPTIMISED_TASK_SELECTION    0
+    #endif
+#endif
+
+#if configUSE_PORT_OPTIMISED_TASK_SELECTION == 1
+
+/* The Cortex-M0+ has no CLZ instruction, so the highest set bit is found by
+ * smearing it into every lower bit and then indexing a de Bruijn table with
+ * the top five bits of a multiply, which is a single cycle on the RP2040.  This
+ * is branch free, so the cost does not depend on which priorities are ready. */
+    __attribute__( ( always_inline ) ) static inline uint8_t ucPortHighestSetBit( uint32_t ulBitmap )
+    {
+        static const uint8_t ucDeBruijnBitPosition[ 32 ] =
+        {
+            0,  9,  1,  10, 13, 21, 2,  29, 11, 14, 16, 18, 22, 25, 3, 30,
+            8,  12, 20, 28, 15, 17, 24, 7,  19, 27, 23, 6,  26, 5,  4, 31
+        };
+
+        ulBitmap |= ulBitmap >> 1;
+        ulBitmap |= ulBitmap >> 2;
+        ulBitmap |= ulBitmap >> 4;
+        ulBitmap |= ulBitmap >> 8;
+        ulBitmap |= ulBitmap >> 16;
+
+        return ucDeBruijnBitPosition[ ( uint32_t ) ( ulBitmap * 0x07C4ACDDUL ) >> 27 ];
+    }
+
+/* Check the configuration. */
+    #if ( configMAX_PRIORITIES > 32 )
+        #error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES is less than or equal to 32.  It is very rare that a system requires more than 10 to 15 difference priorities as tasks that share a priority will time slice.
+    #endif
+
+/* Store/clear the ready priorities in a bit map. */
+    #define portRECORD_READY_PRIORITY( uxPriority, uxReadyPriorities )    ( uxReadyPriorities ) |= ( 1UL << ( uxPriority ) )
+    #define portRESET_READY_PRIORITY( uxPriority, uxReadyPriorities )     ( uxReadyPriorities ) &= ~( 1UL << ( uxPriority ) )
+
+/*-----------------------------------------------------------*/
+
+    #define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities )    uxTopPriority = ( UBaseType_t ) ucPortHighestSetBit( ( uint32_t ) ( uxReadyPriorities ) )
+
+#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+
+/*-----------------------------------------------------------*/
+
 /* Task function macros as described on the FreeRTOS.org WEB site. */
 #define portTASK_FUNCTION_PROTO( vFunction, pvParameters )    void vFunction( void * pvParameters )
 #define portTASK_FUNCTION( vFunction, pvParameters )          void vFunction( void * pvParameters )
@@ -278,6 +366,14 @@ static inline void vPortRecursiveLock( BaseType_t xCoreID,
 
 #define portMEMORY_BARRIER()    __asm volatile ( "" ::: "memory" )
 
+/* The two cores share SRAM through the bus fabric, so accesses shared between
+ * them are ordered with a DMB rather than just a compiler barrier. */
+#define portDATA_MEMORY_BARRIER()    __asm volatile ( "dmb" ::: "memory" )
+
+#ifndef portFORCE_INLINE
+    #define portFORCE_INLINE    inline __attribute__( ( always_inline ) )
+#endif
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
@@ -0,0 +1,100 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * Copyright (c) 2021 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: MIT AND BSD-3-Clause
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef RP2040_BANKS_H
+#define RP2040_BANKS_H
+
+#ifndef INC_TASK_H
+    #error "include FreeRTOS.h and task.h must appear in source files before include rp2040_banks.h"
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/*
+ * The RP2040 SRAM is made of four 64K banks (SRAM0-3) that the default linker
+ * script maps word striped from 0x20000000, plus two 4K banks (SRAM4/5, aka
+ * SCRATCH_X/Y) that are not striped.  Everything the linker places, including
+ * the FreeRTOS heap, lives in the striped region, so the striped banks are
+ * shared by both cores and by every DMA channel.  The non striped aliases of
+ * SRAM0-3 overlap that region and cannot be handed out without a custom linker
+ * script, which leaves the scratch banks as the only memory a core can own.
+ *
+ * Allocations from the scratch banks are never freed: they are intended for the
+ * stacks and TCBs of tasks that live for the lifetime of the application.
+ */
+#define portRP2040_BANK_STRIPED      ( ( UBaseType_t ) 0 ) /* SRAM0-3 through the FreeRTOS heap - use for DMA buffers. */
+#define portRP2040_BANK_SCRATCH_X    ( ( UBaseType_t ) 1 ) /* SRAM4, shared with core 1's main stack. */
+#define portRP2040_BANK_SCRATCH_Y    ( ( UBaseType_t ) 2 ) /* SRAM5, shared with core 0's main stack. */
+
+/* The scratch bank whose only other user is the given core's main (interrupt)
+ * stack. */
+#define portRP2040_BANK_FOR_CORE( xCoreID )    ( ( ( xCoreID ) == 0 ) ? portRP2040_BANK_SCRATCH_Y : portRP2040_BANK_SCRATCH_X )
+
+#if ( configUSE_RP2040_BANKED_ALLOCATION == 1 )
+
+/*
+ * Allocates xSize bytes, aligned to portBYTE_ALIGNMENT, from the given bank.
+ * Allocations from portRP2040_BANK_STRIPED are forwarded to pvPortMalloc().
+ * Returns NULL if the bank does not have enough space left.
+ */
+    void * pvPortMallocFromBank( UBaseType_t uxBank,
+                                 size_t xSize );
+
+/*
+ * Returns the number of bytes still available in a scratch bank arena.
+ */
+    size_t xPortGetFreeBankSize( UBaseType_t uxBank );
+
+/*
+ * Creates a task exactly like xTaskCreate(), except that both the stack and the
+ * TCB are allocated from uxBank.  If the bank cannot hold them, the task is
+ * created on the heap instead (when configSUPPORT_DYNAMIC_ALLOCATION is 1) so
+ * an undersized arena degrades performance rather than failing the create.
+ */
+    BaseType_t xPortTaskCreateInBank( TaskFunction_t pxTaskCode,
+                                      const char * const pcName,
+                                      const configSTACK_DEPTH_TYPE uxStackDepth,
+                                      void * const pvParameters,
+                                      UBaseType_t uxPriority,
+                                      UBaseType_t uxBank,
+                                      TaskHandle_t * const pxCreatedTask );
+
+#endif /* configUSE_RP2040_BANKED_ALLOCATION */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef RP2040_BANKS_H */
@@ -74,6 +74,134 @@
     #endif
 #endif
 
+/* configUSE_RP2040_BANKED_ALLOCATION == 1 reserves small allocation arenas in
+ * the non striped SCRATCH_X (SRAM4) and SCRATCH_Y (SRAM5) banks, so that hot
+ * task stacks and TCBs can be kept off the striped SRAM0-3 banks used by the
+ * heap and by DMA.  See rp2040_banks.h.  The SDK already places core 1's stack
+ * at the top of SCRATCH_X and core 0's stack at the top of SCRATCH_Y; each arena
+ * takes the space below that stack, so the arena, the stack and any data the
+ * application puts in the bank must fit in its 4K (checked by configASSERT on
+ * allocation).  The arenas take no flash and are not zeroed. */
+#ifndef configUSE_RP2040_BANKED_ALLOCATION
+    #define configUSE_RP2040_BANKED_ALLOCATION    0
+#endif
+
+#if ( configUSE_RP2040_BANKED_ALLOCATION == 1 )
+    #ifndef configRP2040_SCRATCH_X_ARENA_SIZE
+        #define configRP2040_SCRATCH_X_ARENA_SIZE    1024
+    #endif
+
+    #ifndef configRP2040_SCRATCH_Y_ARENA_SIZE
+        #define configRP2040_SCRATCH_Y_ARENA_SIZE    1024
+    #endif
+#endif
+
+/* configUSE_RP2040_TIMER_TICKLESS_IDLE == 1 makes the tickless idle mode
+ * (configUSE_TICKLESS_IDLE == 1) time each sleep with an alarm on the 64 bit
+ * microsecond timer instead of the 24 bit SysTick reload, so a sleep is only
+ * limited by xExpectedIdleTime, and the tick count is corrected from the
+ * microsecond timer on wake up.  The alarm used is claimed from the SDK; alarm
+ * 3 is used by the SDK default alarm pool so alarm 2 is used by default. */
+#ifndef configUSE_RP2040_TIMER_TICKLESS_IDLE
+    #define configUSE_RP2040_TIMER_TICKLESS_IDLE    0
+#endif
+
+#if ( configUSE_RP2040_TIMER_TICKLESS_IDLE == 1 )
+    #if ( configNUMBER_OF_CORES > 1 )
+        #error configUSE_RP2040_TIMER_TICKLESS_IDLE is only supported in single core builds
+    #endif
+
+    #ifndef configRP2040_TICKLESS_ALARM_NUM
+        #define configRP2040_TICKLESS_ALARM_NUM    2
+    #endif
+
+/* configRP2040_TICKLESS_CLOCK_GATING == 1 sleeps in the SLEEP state (WFI with
+ * SLEEPDEEP set), in which every clock not enabled in
+ * configRP2040_TICKLESS_SLEEP_EN0/1 is gated.  The default keeps only the
+ * timer and the watchdog tick that drives it running, so any other peripheral
+ * that must be able to wake the core (GPIO, UART, USB...) has to be added to
+ * the masks.  The clocks are shared by both cores, so this is only suitable
+ * when core 1 is idle too. */
+    #ifndef configRP2040_TICKLESS_CLOCK_GATING
+        #define configRP2040_TICKLESS_CLOCK_GATING    0
+    #endif
+
+    #ifndef configRP2040_TICKLESS_SLEEP_EN0
+        #define configRP2040_TICKLESS_SLEEP_EN0    0UL
+    #endif
+
+    #ifndef configRP2040_TICKLESS_SLEEP_EN1
+        #define configRP2040_TICKLESS_SLEEP_EN1    ( CLOCKS_SLEEP_EN1_CLK_SYS_TIMER_BITS | CLOCKS_SLEEP_EN1_CLK_SYS_WATCHDOG_BITS )
+    #endif
+#endif
+
+/* configUSE_RP2040_US_DELAYS == 1 provides microsecond resolution task delays
+ * and block times woken by SDK alarms.  See rp2040_delay_us.h.  A thread local
+ * storage pointer and a task notification index are reserved for them in every
+ * task. */
+#ifndef configUSE_RP2040_US_DELAYS
+    #define configUSE_RP2040_US_DELAYS    0
+#endif
+
+#if ( configUSE_RP2040_US_DELAYS == 1 )
+    #ifndef configRP2040_US_DELAY_TLS_INDEX
+        #define configRP2040_US_DELAY_TLS_INDEX    ( configNUM_THREAD_LOCAL_STORAGE_POINTERS - 1 )
+    #endif
+
+    #ifndef configRP2040_US_DELAY_NOTIFY_INDEX
+        #define configRP2040_US_DELAY_NOTIFY_INDEX    ( configTASK_NOTIFICATION_ARRAY_ENTRIES - 1 )
+    #endif
+
+/* Waits shorter than this are busy waits, as blocking and being woken again
+ * would take about as long. */
+    #ifndef configRP2040_US_DELAY_SPIN_US
+        #define configRP2040_US_DELAY_SPIN_US    20
+    #endif
+#endif
+
+/* configUSE_RP2040_CORE_CHANNEL == 1 provides a channel into each core that
+ * carries 32-bit messages through the SIO FIFOs.  See rp2040_core_channel.h.
+ * A task notification index is reserved for it in every task. */
+#ifndef configUSE_RP2040_CORE_CHANNEL
+    #define configUSE_RP2040_CORE_CHANNEL    0
+#endif
+
+#if ( configUSE_RP2040_CORE_CHANNEL == 1 )
+    #ifndef configRP2040_CORE_CHANNEL_NOTIFY_INDEX
+        #define configRP2040_CORE_CHANNEL_NOTIFY_INDEX    ( configTASK_NOTIFICATION_ARRAY_ENTRIES - 1 )
+    #endif
+
+/* The number of messages each core buffers, which must be a power of two. */
+    #ifndef configRP2040_CORE_CHANNEL_LENGTH
+        #define configRP2040_CORE_CHANNEL_LENGTH    16
+    #endif
+#endif
+
+/* configUSE_RP2040_CRITICAL_STATS == 1 times, with the 1MHz hardware timer,
+ * every period in which the port masks interrupts, and records the longest
+ * ones per call site and per task.  See rp2040_critical_stats.h.  Every
+ * interrupt mask and unmask becomes a function call, so this is a debugging
+ * aid rather than something to leave enabled. */
+#ifndef configUSE_RP2040_CRITICAL_STATS
+    #define configUSE_RP2040_CRITICAL_STATS    0
+#endif
+
+#if ( configUSE_RP2040_CRITICAL_STATS == 1 )
+    #ifndef configRP2040_CRITICAL_STATS_SITES
+        #define configRP2040_CRITICAL_STATS_SITES    16
+    #endif
+
+    #ifndef configRP2040_CRITICAL_STATS_TASKS
+        #define configRP2040_CRITICAL_STATS_TASKS    8
+    #endif
+
+/* Histogram bucket 0 counts periods under 1us, bucket n those from 2^(n-1)us
+ * to under 2^n us, and the last bucket everything longer. */
+    #ifndef configRP2040_CRITICAL_STATS_BUCKETS
+        #define configRP2040_CRITICAL_STATS_BUCKETS    8
+    #endif
+#endif
+
 /* This SMP port requires two spin locks, which are claimed from the SDK.
  * the spin lock numbers to be used are defined statically and defaulted here
  * to the values nominally set aside for RTOS by the SDK */
@@ -0,0 +1,109 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * Copyright (c) 2021 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: MIT AND BSD-3-Clause
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef RP2040_CORE_CHANNEL_H
+#define RP2040_CORE_CHANNEL_H
+
+#ifndef INC_TASK_H
+    #error "include FreeRTOS.h and task.h must appear in source files before include rp2040_core_channel.h"
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/*
+ * Core channels carry 32-bit messages, such as values or pointers, from one
+ * core to the other through the SIO FIFOs the SMP port already uses to make
+ * the other core yield.  A message is written straight into the hardware FIFO
+ * and moved into a small buffer owned by the receiving core by that core's
+ * FIFO interrupt, which then notifies the receiving task.  No critical section
+ * or kernel lock is taken on either side, so a message typically reaches the
+ * other core's task in the time it takes that core to service one interrupt
+ * and switch context.
+ *
+ * There is one channel into each core.  xPortCoreChannelSend() sends to the
+ * core other than the one the caller is running on, and
+ * xPortCoreChannelReceive() receives the messages sent to the core the caller
+ * is running on, so both tasks should have their core affinity set to a single
+ * core.  Each channel has at most one task blocked sending to it and at most
+ * one task receiving from it.  Messages sent from interrupts on the sending
+ * core are delivered in order with those sent by its task.
+ *
+ * A sender can only have configRP2040_CORE_CHANNEL_LENGTH messages in flight
+ * that the receiving task has not taken yet, so the receiving core's interrupt
+ * never has to drop or hold back a message.  The channel must only be used
+ * once the scheduler is running on both cores.
+ */
+
+/* The word the port writes to the FIFO to make the other core yield.  It can
+ * therefore not be sent as a message; no valid pointer has this value. */
+#define portRP2040_CORE_CHANNEL_RESERVED_MESSAGE    ( ( uint32_t ) 0xFFFFFFFFUL )
+
+#if ( configUSE_RP2040_CORE_CHANNEL == 1 )
+
+/*
+ * Sends ulMessage to the other core, blocking for up to xTicksToWait ticks if
+ * that core's channel already holds configRP2040_CORE_CHANNEL_LENGTH messages.
+ * ulMessage must not be portRP2040_CORE_CHANNEL_RESERVED_MESSAGE.
+ *
+ * Returns pdPASS if the message was sent, otherwise errQUEUE_FULL.
+ */
+    BaseType_t xPortCoreChannelSend( uint32_t ulMessage,
+                                     TickType_t xTicksToWait );
+
+/*
+ * A version of xPortCoreChannelSend() that can be called from an interrupt
+ * service routine.  It never blocks, and also fails if the hardware FIFO is
+ * momentarily full.
+ *
+ * Returns pdPASS if the message was sent, otherwise errQUEUE_FULL.
+ */
+    BaseType_t xPortCoreChannelSendFromISR( uint32_t ulMessage );
+
+/*
+ * Receives the oldest message sent to the calling core into *pulMessage,
+ * blocking for up to xTicksToWait ticks if there is none.
+ *
+ * Returns pdPASS if a message was received, otherwise errQUEUE_EMPTY.
+ */
+    BaseType_t xPortCoreChannelReceive( uint32_t * pulMessage,
+                                        TickType_t xTicksToWait );
+
+#endif /* configUSE_RP2040_CORE_CHANNEL */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef RP2040_CORE_CHANNEL_H */
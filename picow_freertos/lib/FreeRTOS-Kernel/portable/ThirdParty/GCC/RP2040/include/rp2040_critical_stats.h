@@ -0,0 +1,104 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * Copyright (c) 2021 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: MIT AND BSD-3-Clause
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef RP2040_CRITICAL_STATS_H
+#define RP2040_CRITICAL_STATS_H
+
+#ifndef INC_TASK_H
+    #error "include FreeRTOS.h and task.h must appear in source files before include rp2040_critical_stats.h"
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/*
+ * Interrupt masked time statistics.  When configUSE_RP2040_CRITICAL_STATS is
+ * 1, every period in which interrupts are masked through the port - critical
+ * sections, portSET_INTERRUPT_MASK_FROM_ISR(), portDISABLE_INTERRUPTS() - is
+ * timed from the moment interrupts are masked until they are unmasked again.
+ * Nested masking is part of the outermost period.  These periods bound the
+ * interrupt latency of the core they run on.
+ *
+ * Each period is attributed to a call site: the return address of the
+ * taskENTER_CRITICAL(), taskENTER_CRITICAL_FROM_ISR() or interrupt masking
+ * macro that started it, which addr2line maps back to a source line.  It is
+ * also attributed to the task that was running, or to NULL when the period
+ * started in an interrupt.  The first configRP2040_CRITICAL_STATS_SITES sites
+ * and configRP2040_CRITICAL_STATS_TASKS tasks seen each get an entry; later
+ * ones are only counted in the totals of their core.
+ *
+ * Masking done by the SDK, or by code that writes PRIMASK itself, is not seen.
+ * Times are whole microseconds, so periods shorter than 1us read as 0.
+ */
+
+#if ( configUSE_RP2040_CRITICAL_STATS == 1 )
+
+    typedef struct PortCriticalEntryStats
+    {
+        const void * pvKey;                                       /* The call site, or the task handle. */
+        uint32_t ulCount;                                         /* Number of periods. */
+        uint32_t ulMaxUs;                                         /* Longest period. */
+        uint32_t ulHistogram[ configRP2040_CRITICAL_STATS_BUCKETS ]; /* Periods by length, see configRP2040_CRITICAL_STATS_BUCKETS. */
+    } PortCriticalEntryStats_t;
+
+    typedef struct PortCriticalStats
+    {
+        PortCriticalEntryStats_t xTotal;                                            /* Every period on the core; pvKey is the site of the longest. */
+        PortCriticalEntryStats_t xSites[ configRP2040_CRITICAL_STATS_SITES ];       /* Entries in use have a non NULL pvKey. */
+        PortCriticalEntryStats_t xTasks[ configRP2040_CRITICAL_STATS_TASKS ];       /* Entries in use have a non zero ulCount. */
+        uint32_t ulUntrackedSites;                                                  /* Periods from sites that found the site table full. */
+        uint32_t ulUntrackedTasks;                                                  /* Periods from tasks that found the task table full. */
+    } PortCriticalStats_t;
+
+/*
+ * Copies the statistics recorded on core xCoreID into *pxStats.  The copy is
+ * taken with interrupts masked, which is itself recorded as a short period,
+ * and can catch the other core's statistics part way through an update.
+ */
+    void vPortGetCriticalStats( BaseType_t xCoreID,
+                                PortCriticalStats_t * pxStats );
+
+/*
+ * Clears the statistics of the calling core, for example once start up, with
+ * its longer critical sections, is over.
+ */
+    void vPortResetCriticalStats( void );
+
+#endif /* configUSE_RP2040_CRITICAL_STATS */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef RP2040_CRITICAL_STATS_H */
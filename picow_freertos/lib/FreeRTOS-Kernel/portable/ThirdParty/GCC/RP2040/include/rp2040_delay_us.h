@@ -0,0 +1,108 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * Copyright (c) 2021 Raspberry Pi (Trading) Ltd.
+ *
+ * SPDX-License-Identifier: MIT AND BSD-3-Clause
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef RP2040_DELAY_US_H
+#define RP2040_DELAY_US_H
+
+#ifndef INC_TASK_H
+    #error "include FreeRTOS.h and task.h must appear in source files before include rp2040_delay_us.h"
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/*
+ * Microsecond resolution delays and block times.  A task waiting on one of
+ * these functions still blocks at the FreeRTOS level, but is woken by an alarm
+ * from the SDK default alarm pool (hardware alarm 3) at the requested time
+ * rather than by the tick, so the wait neither jitters by up to a tick nor is
+ * limited to whole ticks.  configTICK_RATE_HZ can therefore stay low while a
+ * few tasks run control loops at kHz rates.
+ *
+ * Waits shorter than configRP2040_US_DELAY_SPIN_US, waits made before the
+ * scheduler is started and waits made from core 1 of a single core build are
+ * busy waits.  A task must not be deleted while it is in one of these waits.
+ */
+
+#if ( configUSE_RP2040_US_DELAYS == 1 )
+
+/*
+ * Delays the calling task for ullDelayUs microseconds.
+ */
+    void vPortTaskDelayUs( uint64_t ullDelayUs );
+
+/*
+ * The microsecond equivalent of xTaskDelayUntil().  *pullPreviousWakeTimeUs
+ * holds the time, from time_us_64(), the task was last woken and is updated to
+ * the time it is woken this time.  Initialise it with time_us_64() before the
+ * first call.
+ *
+ * Returns pdFALSE if the wake time had already passed, in which case the task
+ * was not delayed, otherwise pdTRUE.
+ */
+    BaseType_t xPortTaskDelayUntilUs( uint64_t * const pullPreviousWakeTimeUs,
+                                      const uint64_t ullTimeIncrementUs );
+
+/*
+ * Gives a microsecond resolution block time to any FreeRTOS API function that
+ * takes a block time in ticks.  xPortTimeoutUsBegin() arms an alarm that
+ * removes the calling task from the Blocked state ullTimeoutUs from now, and
+ * returns the block time, in ticks, to pass to the blocking function - which
+ * is slightly longer than ullTimeoutUs so the alarm always fires first.
+ * vPortTimeoutUsEnd() must be called as soon as the blocking function returns.
+ * Only one such timeout can be outstanding per task.
+ *
+ * Example use:
+ * @code{c}
+ * if( xQueueReceive( xQueue, &xItem, xPortTimeoutUsBegin( 250 ) ) == pdPASS )
+ * {
+ *     ...
+ * }
+ * vPortTimeoutUsEnd();
+ * @endcode
+ *
+ * The alarm interrupt cannot remove a task from an arbitrary event list, so
+ * the timeout is delivered through the timer task; it is as precise as the
+ * timer task is prompt, which it is when it has the highest priority.
+ */
+    TickType_t xPortTimeoutUsBegin( uint64_t ullTimeoutUs );
+    void vPortTimeoutUsEnd( void );
+
+#endif /* configUSE_RP2040_US_DELAYS */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef RP2040_DELAY_US_H */
@@ -9,7 +9,9 @@ target_sources(FreeRTOS-Kernel-Core INTERFACE
         ${FREERTOS_KERNEL_PATH}/croutine.c
         ${FREERTOS_KERNEL_PATH}/event_groups.c
         ${FREERTOS_KERNEL_PATH}/list.c
+        ${FREERTOS_KERNEL_PATH}/memory_pool.c
         ${FREERTOS_KERNEL_PATH}/queue.c
+        ${FREERTOS_KERNEL_PATH}/spsc_ring.c
         ${FREERTOS_KERNEL_PATH}/stream_buffer.c
         ${FREERTOS_KERNEL_PATH}/tasks.c
         ${FREERTOS_KERNEL_PATH}/timers.c
@@ -35,6 +37,7 @@ target_link_libraries(FreeRTOS-Kernel INTERFACE
         pico_base_headers
         hardware_clocks
         hardware_exception
+        hardware_timer
         pico_multicore
 )
 
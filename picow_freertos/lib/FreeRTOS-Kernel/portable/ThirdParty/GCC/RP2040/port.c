@@ -34,6 +34,7 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "rp2040_config.h"
+#include "rp2040_core_channel.h"
 #include "hardware/clocks.h"
 #include "hardware/exception.h"
 
@@ -46,6 +47,13 @@
     #include "pico/multicore.h"
 #endif /* LIB_PICO_MULTICORE */
 
+#if ( configUSE_TICKLESS_IDLE == 1 ) && ( configUSE_RP2040_TIMER_TICKLESS_IDLE == 1 )
+    #include "hardware/timer.h"
+    #if ( configRP2040_TICKLESS_CLOCK_GATING == 1 )
+        #include "hardware/structs/scb.h"
+    #endif
+#endif
+
 /* Constants required to manipulate the NVIC. */
 #define portNVIC_SYSTICK_CTRL_REG             ( *( ( volatile uint32_t * ) 0xe000e010 ) )
 #define portNVIC_SYSTICK_LOAD_REG             ( *( ( volatile uint32_t * ) 0xe000e014 ) )
@@ -57,6 +65,7 @@
 #define portNVIC_SYSTICK_ENABLE_BIT           ( 1UL << 0UL )
 #define portNVIC_SYSTICK_COUNT_FLAG_BIT       ( 1UL << 16UL )
 #define portNVIC_PENDSVSET_BIT                ( 1UL << 28UL )
+#define portNVIC_PENDSTSET_BIT                ( 1UL << 26UL )
 #define portMIN_INTERRUPT_PRIORITY            ( 255UL )
 #define portNVIC_PENDSV_PRI                   ( portMIN_INTERRUPT_PRIORITY << 16UL )
 #define portNVIC_SYSTICK_PRI                  ( portMIN_INTERRUPT_PRIORITY << 24UL )
@@ -107,6 +116,15 @@ static void vPortStartFirstTask( void ) __attribute__( ( naked ) );
  */
 static void prvTaskExitError( void );
 
+#if ( configUSE_RP2040_CORE_CHANNEL == 1 )
+
+/*
+ * Moves the messages waiting in this core's FIFO into its core channel, and
+ * discards the yield requests found with them.
+ */
+    static void prvCoreChannelDrainFIFO( void );
+#endif
+
 /*-----------------------------------------------------------*/
 
 /* Each task maintains its own interrupt status in the critical nesting
@@ -280,9 +298,19 @@ void vPortStartFirstTask( void )
 #if ( LIB_PICO_MULTICORE == 1 ) && ( configSUPPORT_PICO_SYNC_INTEROP == 1 )
     static void prvFIFOInterruptHandler()
     {
-        /* We must remove the contents (which we don't care about)
-         * to clear the IRQ */
-        multicore_fifo_drain();
+        #if ( configUSE_RP2040_CORE_CHANNEL == 1 )
+        {
+            /* Core channel messages must be kept, but the FIFO must still be
+             * emptied to clear the IRQ.  Yield requests are handled below. */
+            prvCoreChannelDrainFIFO();
+        }
+        #else
+        {
+            /* We must remove the contents (which we don't care about)
+             * to clear the IRQ */
+            multicore_fifo_drain();
+        }
+        #endif /* configUSE_RP2040_CORE_CHANNEL */
 
         /* And explicitly clear any other IRQ flags. */
         multicore_fifo_clear_irq();
@@ -518,8 +546,9 @@ void vYieldCore( int xCoreID )
     #if configNUMBER_OF_CORES != 1
 
         /* Non blocking, will cause interrupt on other core if the queue isn't already full,
-         * in which case an IRQ must be pending */
-        sio_hw->fifo_wr = 0;
+         * in which case an IRQ must be pending.  The value written is reserved
+         * so it cannot be mistaken for a core channel message. */
+        sio_hw->fifo_wr = portRP2040_CORE_CHANNEL_RESERVED_MESSAGE;
     #endif
 }
 
@@ -733,6 +762,17 @@ void xPortSysTickHandler( void )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TICKLESS_IDLE == 1 ) && ( configUSE_RP2040_TIMER_TICKLESS_IDLE == 1 )
+
+    static void prvTicklessAlarmCallback( uint alarm_num )
+    {
+        /* Nothing to do - taking the interrupt is enough to end the sleep. */
+        ( void ) alarm_num;
+    }
+
+#endif /* ( configUSE_TICKLESS_IDLE == 1 ) && ( configUSE_RP2040_TIMER_TICKLESS_IDLE == 1 ) */
+/*-----------------------------------------------------------*/
+
 /*
  * Setup the systick timer to generate the tick interrupts at the required
  * frequency.
@@ -745,6 +785,15 @@ __attribute__( ( weak ) ) void vPortSetupTimerInterrupt( void )
         ulTimerCountsForOneTick = ( clock_get_hz( clk_sys ) / configTICK_RATE_HZ );
         xMaximumPossibleSuppressedTicks = portMAX_24_BIT_NUMBER / ulTimerCountsForOneTick;
         ulStoppedTimerCompensation = portMISSED_COUNTS_FACTOR;
+
+        #if ( configUSE_RP2040_TIMER_TICKLESS_IDLE == 1 )
+        {
+            /* The alarm that ends each tickless sleep.  Its interrupt is
+             * enabled on this core, the core that handles the tick. */
+            hardware_alarm_claim( configRP2040_TICKLESS_ALARM_NUM );
+            hardware_alarm_set_callback( configRP2040_TICKLESS_ALARM_NUM, prvTicklessAlarmCallback );
+        }
+        #endif
     }
     #endif /* configUSE_TICKLESS_IDLE */
 
@@ -758,7 +807,149 @@ __attribute__( ( weak ) ) void vPortSetupTimerInterrupt( void )
 }
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TICKLESS_IDLE == 1 )
+#if ( configUSE_TICKLESS_IDLE == 1 ) && ( configUSE_RP2040_TIMER_TICKLESS_IDLE == 1 )
+
+    __attribute__( ( weak ) ) void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+    {
+        const uint64_t ullTickPeriodUs = ( uint64_t ) ( 1000000UL / configTICK_RATE_HZ );
+        uint64_t ullTickStartUs, ullSleptUs;
+        uint32_t ulElapsedCounts, ulReloadValue;
+        TickType_t xCompleteTickPeriods, xModifiableIdleTime;
+        bool xAlarmMissed;
+
+        /* Stop the SysTick for the duration of the sleep.  Unlike the SysTick
+         * only implementation below no time is lost while it is stopped, as
+         * the tick count is corrected from the free running microsecond
+         * timer. */
+        portNVIC_SYSTICK_CTRL_REG &= ~portNVIC_SYSTICK_ENABLE_BIT;
+
+        /* Enter a critical section but don't use the taskENTER_CRITICAL()
+         * method as that will mask interrupts that should exit sleep mode. */
+        __asm volatile ( "cpsid i" ::: "memory" );
+        __asm volatile ( "dsb" );
+        __asm volatile ( "isb" );
+
+        /* If a context switch is pending or a task is waiting for the scheduler
+         * to be unsuspended then abandon the low power entry. */
+        if( eTaskConfirmSleepModeStatus() == eAbortSleep )
+        {
+            /* Restart from whatever is left in the count register to complete
+             * this tick period. */
+            portNVIC_SYSTICK_LOAD_REG = portNVIC_SYSTICK_CURRENT_VALUE_REG;
+
+            /* Restart SysTick. */
+            portNVIC_SYSTICK_CTRL_REG |= portNVIC_SYSTICK_ENABLE_BIT;
+
+            /* Reset the reload register to the value required for normal tick
+             * periods. */
+            portNVIC_SYSTICK_LOAD_REG = ulTimerCountsForOneTick - 1UL;
+
+            /* Re-enable interrupts - see comments above the cpsid instruction()
+             * above. */
+            __asm volatile ( "cpsie i" ::: "memory" );
+        }
+        else
+        {
+            /* Find the time on the microsecond timer at which the current tick
+             * period started, from how far the SysTick had counted down, so
+             * the sleep ends exactly on a tick boundary. */
+            ulElapsedCounts = ( ulTimerCountsForOneTick - 1UL ) - portNVIC_SYSTICK_CURRENT_VALUE_REG;
+            ullTickStartUs = time_us_64() - ( ( ( uint64_t ) ulElapsedCounts * ullTickPeriodUs ) / ulTimerCountsForOneTick );
+
+            /* Arm the alarm for the end of the expected idle time.  The SDK
+             * alarm handler takes care of targets beyond the 32 bit range of
+             * the alarm comparator. */
+            xAlarmMissed = hardware_alarm_set_target( configRP2040_TICKLESS_ALARM_NUM,
+                                                      from_us_since_boot( ullTickStartUs + ( ( uint64_t ) xExpectedIdleTime * ullTickPeriodUs ) ) );
+
+            /* Sleep until something happens.  configPRE_SLEEP_PROCESSING() can
+             * set its parameter to 0 to indicate that its implementation contains
+             * its own wait for interrupt or wait for event instruction, and so wfi
+             * should not be executed again.  However, the original expected idle
+             * time variable must remain unmodified, so a copy is taken. */
+            xModifiableIdleTime = xExpectedIdleTime;
+            configPRE_SLEEP_PROCESSING( xModifiableIdleTime );
+
+            if( ( xModifiableIdleTime > 0 ) && ( xAlarmMissed == false ) )
+            {
+                #if ( configRP2040_TICKLESS_CLOCK_GATING == 1 )
+                    const uint32_t ulSleepEn0 = clocks_hw->sleep_en0;
+                    const uint32_t ulSleepEn1 = clocks_hw->sleep_en1;
+
+                    clocks_hw->sleep_en0 = configRP2040_TICKLESS_SLEEP_EN0;
+                    clocks_hw->sleep_en1 = configRP2040_TICKLESS_SLEEP_EN1;
+                    scb_hw->scr |= M0PLUS_SCR_SLEEPDEEP_BITS;
+                #endif
+
+                __asm volatile ( "dsb" ::: "memory" );
+                __asm volatile ( "wfi" );
+                __asm volatile ( "isb" );
+
+                #if ( configRP2040_TICKLESS_CLOCK_GATING == 1 )
+                    scb_hw->scr &= ~M0PLUS_SCR_SLEEPDEEP_BITS;
+                    clocks_hw->sleep_en0 = ulSleepEn0;
+                    clocks_hw->sleep_en1 = ulSleepEn1;
+                #endif
+            }
+
+            configPOST_SLEEP_PROCESSING( xExpectedIdleTime );
+
+            /* Re-enable interrupts to allow the interrupt that brought the MCU
+             * out of sleep mode to execute immediately, then disable them again
+             * while the tick count is corrected. */
+            __asm volatile ( "cpsie i" ::: "memory" );
+            __asm volatile ( "dsb" );
+            __asm volatile ( "isb" );
+            __asm volatile ( "cpsid i" ::: "memory" );
+            __asm volatile ( "dsb" );
+            __asm volatile ( "isb" );
+
+            hardware_alarm_cancel( configRP2040_TICKLESS_ALARM_NUM );
+
+            /* Work out how many complete tick periods passed while asleep, and
+             * how much of the current tick period remains. */
+            ullSleptUs = time_us_64() - ullTickStartUs;
+
+            if( ullSleptUs >= ( ( uint64_t ) xExpectedIdleTime * ullTickPeriodUs ) )
+            {
+                /* The alarm ended the sleep (or the sleep overran).  The tick
+                 * at the end of the idle period is processed by the SysTick
+                 * handler, which is pended here and runs as soon as interrupts
+                 * are re-enabled, so the tick count is stepped forward by one
+                 * less than the time spent waiting. */
+                xCompleteTickPeriods = xExpectedIdleTime - ( TickType_t ) 1;
+                portNVIC_INT_CTRL_REG = portNVIC_PENDSTSET_BIT;
+            }
+            else
+            {
+                /* Something other than the alarm ended the sleep. */
+                xCompleteTickPeriods = ( TickType_t ) ( ullSleptUs / ullTickPeriodUs );
+            }
+
+            /* Restart SysTick from whatever fraction of a tick period remains,
+             * so the tick stays in phase with the microsecond timer, then set
+             * portNVIC_SYSTICK_LOAD_REG back to its standard value. */
+            ulReloadValue = ( uint32_t ) ( ( ( ullTickPeriodUs - ( ullSleptUs % ullTickPeriodUs ) ) * ulTimerCountsForOneTick ) / ullTickPeriodUs );
+
+            /* Don't allow a reload value so small the SysTick cannot count it
+             * down. */
+            if( ulReloadValue < 2UL )
+            {
+                ulReloadValue = 2UL;
+            }
+
+            portNVIC_SYSTICK_LOAD_REG = ulReloadValue - 1UL;
+            portNVIC_SYSTICK_CURRENT_VALUE_REG = 0UL;
+            portNVIC_SYSTICK_CTRL_REG |= portNVIC_SYSTICK_ENABLE_BIT;
+            vTaskStepTick( xCompleteTickPeriods );
+            portNVIC_SYSTICK_LOAD_REG = ulTimerCountsForOneTick - 1UL;
+
+            /* Exit with interrupts enabled. */
+            __asm volatile ( "cpsie i" ::: "memory" );
+        }
+    }
+
+#elif ( configUSE_TICKLESS_IDLE == 1 )
 
     __attribute__( ( weak ) ) void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
     {
@@ -927,7 +1118,7 @@ __attribute__( ( weak ) ) void vPortSetupTimerInterrupt( void )
 
 #endif /* configUSE_TICKLESS_IDLE */
 
-#if ( configSUPPORT_PICO_SYNC_INTEROP == 1 ) || ( configSUPPORT_PICO_TIME_INTEROP == 1 )
+#if ( configSUPPORT_PICO_SYNC_INTEROP == 1 ) || ( ( configSUPPORT_PICO_TIME_INTEROP == 1 ) && ( configUSE_RP2040_US_DELAYS == 0 ) )
     static TickType_t prvGetTicksToWaitBefore( absolute_time_t t )
     {
         int64_t xDelay = absolute_time_diff_us( get_absolute_time(), t );
@@ -942,7 +1133,7 @@ __attribute__( ( weak ) ) void vPortSetupTimerInterrupt( void )
 
         return 0;
     }
-#endif /* if ( configSUPPORT_PICO_SYNC_INTEROP == 1 ) || ( configSUPPORT_PICO_TIME_INTEROP == 1 ) */
+#endif /* if ( configSUPPORT_PICO_SYNC_INTEROP == 1 ) || ( ( configSUPPORT_PICO_TIME_INTEROP == 1 ) && ( configUSE_RP2040_US_DELAYS == 0 ) ) */
 
 #if ( configSUPPORT_PICO_SYNC_INTEROP == 1 )
     uint32_t ulPortLockGetCurrentOwnerId()
@@ -1165,14 +1356,949 @@ __attribute__( ( weak ) ) void vPortSetupTimerInterrupt( void )
     #endif /* if ( configSUPPORT_PICO_SYNC_INTEROP == 1 ) */
 #endif /* configSUPPORT_PICO_SYNC_INTEROP */
 
+#if ( configUSE_RP2040_US_DELAYS == 1 )
+    #include "pico/time.h"
+    #include "timers.h"
+    #include "rp2040_delay_us.h"
+
+    #if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS < 1 )
+        #error configUSE_RP2040_US_DELAYS requires configNUM_THREAD_LOCAL_STORAGE_POINTERS to be at least 1
+    #endif
+
+    #if ( configTASK_NOTIFICATION_ARRAY_ENTRIES < 2 )
+        #error configUSE_RP2040_US_DELAYS requires configTASK_NOTIFICATION_ARRAY_ENTRIES to be at least 2, so notification index 0 remains free for the application
+    #endif
+
+    #if ( INCLUDE_xTaskAbortDelay == 0 ) || ( configUSE_TIMERS == 0 ) || ( INCLUDE_xTimerPendFunctionCall == 0 )
+        #error configUSE_RP2040_US_DELAYS requires INCLUDE_xTaskAbortDelay, configUSE_TIMERS and INCLUDE_xTimerPendFunctionCall to be set to 1
+    #endif
+
+    #define portUS_PER_TICK    ( ( uint64_t ) ( 1000000UL / configTICK_RATE_HZ ) )
+
+/* The thread local storage pointer reserved in each task holds the id of the
+ * alarm armed for its current wait, 0 if there is none, or
+ * portUS_WAIT_ABORTING while the timer task is aborting a block time.  The
+ * alarm callbacks only act if the alarm is still the one recorded, so an alarm
+ * that fires just as its wait ends cannot cut short the task's next wait. */
+    #define portUS_WAIT_NONE         ( ( intptr_t ) 0 )
+    #define portUS_WAIT_ABORTING     ( ( intptr_t ) -1 )
+
+    #define portGET_US_WAIT( xTask )              ( ( intptr_t ) pvTaskGetThreadLocalStoragePointer( ( xTask ), configRP2040_US_DELAY_TLS_INDEX ) )
+    #define portSET_US_WAIT( xTask, xWait )       vTaskSetThreadLocalStoragePointer( ( xTask ), configRP2040_US_DELAY_TLS_INDEX, ( void * ) ( intptr_t ) ( xWait ) )
+
+    static BaseType_t prvCanBlockForUs( void )
+    {
+        return ( ( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING ) && portIS_FREE_RTOS_CORE() && !portCHECK_IF_IN_ISR() ) ? pdTRUE : pdFALSE;
+    }
+/*-----------------------------------------------------------*/
+
+/* The block time, in ticks, that covers ullUs even if the current tick is
+ * about to end, plus one tick so the alarm always fires first. */
+    static TickType_t prvUsToBackstopTicks( uint64_t ullUs )
+    {
+        const uint64_t ullTicks = ( ullUs / portUS_PER_TICK ) + 2U;
+
+        return ( ullTicks < ( uint64_t ) portMAX_DELAY ) ? ( TickType_t ) ullTicks : ( portMAX_DELAY - ( TickType_t ) 1 );
+    }
+/*-----------------------------------------------------------*/
+
+    static alarm_id_t prvArmUsAlarm( uint64_t ullTargetUs,
+                                     alarm_callback_t xCallback )
+    {
+        TaskHandle_t xTask = xTaskGetCurrentTaskHandle();
+        alarm_id_t xAlarm;
+
+        /* Record the alarm before its callback can run - the callback takes
+         * the same critical section to check it. */
+        taskENTER_CRITICAL();
+        {
+            xAlarm = add_alarm_at( from_us_since_boot( ullTargetUs ), xCallback, xTask, false );
+
+            if( xAlarm > 0 )
+            {
+                portSET_US_WAIT( xTask, xAlarm );
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        return xAlarm;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvDisarmUsAlarm( void )
+    {
+        TaskHandle_t xTask = xTaskGetCurrentTaskHandle();
+        intptr_t xWait;
+
+        for( ; ; )
+        {
+            taskENTER_CRITICAL();
+            {
+                xWait = portGET_US_WAIT( xTask );
+
+                if( xWait != portUS_WAIT_ABORTING )
+                {
+                    portSET_US_WAIT( xTask, portUS_WAIT_NONE );
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( xWait != portUS_WAIT_ABORTING )
+            {
+                break;
+            }
+
+            /* The timer task is part way through aborting this task's block
+             * time on the other core. */
+            taskYIELD();
+        }
+
+        if( xWait > portUS_WAIT_NONE )
+        {
+            ( void ) cancel_alarm( ( alarm_id_t ) xWait );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static int64_t prvDelayUsAlarmCallback( alarm_id_t xAlarm,
+                                            void * pvTask )
+    {
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+        UBaseType_t uxSavedInterruptStatus;
+
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        {
+            if( portGET_US_WAIT( pvTask ) == ( intptr_t ) xAlarm )
+            {
+                vTaskNotifyGiveIndexedFromISR( ( TaskHandle_t ) pvTask, configRP2040_US_DELAY_NOTIFY_INDEX, &xHigherPriorityTaskWoken );
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+
+        /* Do not reschedule the alarm. */
+        return 0;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvTimeoutUsExpired( void * pvTask,
+                                     uint32_t ulAlarm )
+    {
+        BaseType_t xCurrent;
+
+        taskENTER_CRITICAL();
+        {
+            xCurrent = ( portGET_US_WAIT( pvTask ) == ( intptr_t ) ulAlarm ) ? pdTRUE : pdFALSE;
+
+            if( xCurrent != pdFALSE )
+            {
+                portSET_US_WAIT( pvTask, portUS_WAIT_ABORTING );
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xCurrent != pdFALSE )
+        {
+            /* Keep the scheduler suspended until the wait has been cleared,
+             * otherwise a higher priority task made ready by the abort would
+             * preempt the timer task and spin on portUS_WAIT_ABORTING. */
+            vTaskSuspendAll();
+            {
+                ( void ) xTaskAbortDelay( ( TaskHandle_t ) pvTask );
+
+                taskENTER_CRITICAL();
+                {
+                    portSET_US_WAIT( pvTask, portUS_WAIT_NONE );
+                }
+                taskEXIT_CRITICAL();
+            }
+            ( void ) xTaskResumeAll();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static int64_t prvTimeoutUsAlarmCallback( alarm_id_t xAlarm,
+                                              void * pvTask )
+    {
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+        BaseType_t xCurrent;
+        UBaseType_t uxSavedInterruptStatus;
+
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        {
+            xCurrent = ( portGET_US_WAIT( pvTask ) == ( intptr_t ) xAlarm ) ? pdTRUE : pdFALSE;
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        if( xCurrent != pdFALSE )
+        {
+            /* An interrupt cannot remove a task from whatever event list it is
+             * blocked on, so leave that to the timer task. */
+            ( void ) xTimerPendFunctionCallFromISR( prvTimeoutUsExpired, pvTask, ( uint32_t ) xAlarm, &xHigherPriorityTaskWoken );
+        }
+
+        portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+
+        /* Do not reschedule the alarm. */
+        return 0;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvDelayUntilUs( uint64_t ullWakeTimeUs )
+    {
+        uint64_t ullNowUs = time_us_64();
+        alarm_id_t xAlarm;
+
+        while( ( ullWakeTimeUs > ( ullNowUs + ( uint64_t ) configRP2040_US_DELAY_SPIN_US ) ) && ( prvCanBlockForUs() != pdFALSE ) )
+        {
+            /* Discard a notification left by an alarm that fired just as a
+             * previous wait timed out. */
+            ( void ) xTaskNotifyStateClearIndexed( NULL, configRP2040_US_DELAY_NOTIFY_INDEX );
+            ( void ) ulTaskNotifyValueClearIndexed( NULL, configRP2040_US_DELAY_NOTIFY_INDEX, UINT32_MAX );
+
+            xAlarm = prvArmUsAlarm( ullWakeTimeUs, prvDelayUsAlarmCallback );
+
+            if( xAlarm > 0 )
+            {
+                ( void ) ulTaskNotifyTakeIndexed( configRP2040_US_DELAY_NOTIFY_INDEX, pdTRUE, prvUsToBackstopTicks( ullWakeTimeUs - ullNowUs ) );
+                prvDisarmUsAlarm();
+            }
+            else
+            {
+                /* The alarm pool is full, so fall back to the tick for the
+                 * whole ticks. */
+                vTaskDelay( ( TickType_t ) ( ( ullWakeTimeUs - ullNowUs ) / portUS_PER_TICK ) );
+            }
+
+            ullNowUs = time_us_64();
+        }
+
+        /* Spin for whatever is left. */
+        busy_wait_until( from_us_since_boot( ullWakeTimeUs ) );
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortTaskDelayUs( uint64_t ullDelayUs )
+    {
+        prvDelayUntilUs( time_us_64() + ullDelayUs );
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xPortTaskDelayUntilUs( uint64_t * const pullPreviousWakeTimeUs,
+                                      const uint64_t ullTimeIncrementUs )
+    {
+        uint64_t ullTimeToWakeUs;
+        BaseType_t xShouldDelay = pdFALSE;
+
+        configASSERT( pullPreviousWakeTimeUs );
+
+        ullTimeToWakeUs = *pullPreviousWakeTimeUs + ullTimeIncrementUs;
+
+        if( ullTimeToWakeUs > time_us_64() )
+        {
+            xShouldDelay = pdTRUE;
+            prvDelayUntilUs( ullTimeToWakeUs );
+        }
+
+        *pullPreviousWakeTimeUs = ullTimeToWakeUs;
+
+        return xShouldDelay;
+    }
+/*-----------------------------------------------------------*/
+
+    TickType_t xPortTimeoutUsBegin( uint64_t ullTimeoutUs )
+    {
+        TickType_t xTicksToWait = 0;
+
+        configASSERT( prvCanBlockForUs() != pdFALSE );
+
+        if( ullTimeoutUs > 0U )
+        {
+            if( prvArmUsAlarm( time_us_64() + ullTimeoutUs, prvTimeoutUsAlarmCallback ) > 0 )
+            {
+                xTicksToWait = prvUsToBackstopTicks( ullTimeoutUs );
+            }
+            else
+            {
+                /* The alarm pool is full, so round up to whole ticks. */
+                xTicksToWait = prvUsToBackstopTicks( ullTimeoutUs ) - ( TickType_t ) 1;
+            }
+        }
+
+        return xTicksToWait;
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortTimeoutUsEnd( void )
+    {
+        prvDisarmUsAlarm();
+    }
+
+#endif /* configUSE_RP2040_US_DELAYS */
+/*-----------------------------------------------------------*/
+
 #if ( configSUPPORT_PICO_TIME_INTEROP == 1 )
     void xPortSyncInternalYieldUntilBefore( absolute_time_t t )
     {
-        TickType_t uxTicksToWait = prvGetTicksToWaitBefore( t );
-
-        if( uxTicksToWait )
+        #if ( configUSE_RP2040_US_DELAYS == 1 )
+        {
+            /* Block until t itself, rather than until the last tick before
+             * it, leaving nothing for the SDK to busy wait. */
+            prvDelayUntilUs( to_us_since_boot( t ) );
+        }
+        #else
         {
-            vTaskDelay( uxTicksToWait );
+            TickType_t uxTicksToWait = prvGetTicksToWaitBefore( t );
+
+            if( uxTicksToWait )
+            {
+                vTaskDelay( uxTicksToWait );
+            }
         }
+        #endif /* configUSE_RP2040_US_DELAYS */
     }
 #endif /* configSUPPORT_PICO_TIME_INTEROP */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_RP2040_BANKED_ALLOCATION == 1 )
+    #include "rp2040_banks.h"
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 0 )
+        #error configUSE_RP2040_BANKED_ALLOCATION requires configSUPPORT_STATIC_ALLOCATION to be set to 1
+    #endif
+
+    #define portRP2040_BANK_ARENA_ALIGN( xSize )    ( ( ( xSize ) + portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/* The arenas are bump allocated and never freed.  Rather than arrays, which the
+ * SDK linker script would place in .scratch_x/.scratch_y and so load from flash
+ * and copy at boot, each arena is the free gap the script leaves in its bank:
+ * after the bank's initialised data (__scratch_x_end__/__scratch_y_end__) and
+ * below the core stack reserved at the top (__StackOneBottom/__StackBottom).
+ * The memory is neither copied nor zeroed, which a bump allocator for static
+ * task buffers does not need. */
+    extern uint8_t __scratch_x_end__[];
+    extern uint8_t __scratch_y_end__[];
+    extern uint8_t __StackOneBottom[];
+    extern uint8_t __StackBottom[];
+
+    #define portRP2040_BANK_ARENA_BASE( pucEnd )    ( ( uint8_t * ) portRP2040_BANK_ARENA_ALIGN( ( size_t ) ( pucEnd ) ) )
+
+    static size_t xScratchXArenaUsed = 0;
+    static size_t xScratchYArenaUsed = 0;
+
+    static uint8_t * prvGetBankArena( UBaseType_t uxBank,
+                                      size_t ** ppxUsed,
+                                      size_t * pxArenaSize )
+    {
+        uint8_t * pucArena = NULL;
+        uint8_t * pucLimit = NULL;
+
+        if( uxBank == portRP2040_BANK_SCRATCH_X )
+        {
+            pucArena = portRP2040_BANK_ARENA_BASE( __scratch_x_end__ );
+            pucLimit = __StackOneBottom;
+            *ppxUsed = &xScratchXArenaUsed;
+            *pxArenaSize = portRP2040_BANK_ARENA_ALIGN( configRP2040_SCRATCH_X_ARENA_SIZE );
+        }
+        else if( uxBank == portRP2040_BANK_SCRATCH_Y )
+        {
+            pucArena = portRP2040_BANK_ARENA_BASE( __scratch_y_end__ );
+            pucLimit = __StackBottom;
+            *ppxUsed = &xScratchYArenaUsed;
+            *pxArenaSize = portRP2040_BANK_ARENA_ALIGN( configRP2040_SCRATCH_Y_ARENA_SIZE );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* The configured arena must fit between the bank's data and the core
+         * stack; shrink it or the stack (PICO_STACK_SIZE/PICO_CORE1_STACK_SIZE)
+         * if this fails. */
+        configASSERT( ( pucArena == NULL ) || ( ( pucArena + *pxArenaSize ) <= pucLimit ) );
+
+        return pucArena;
+    }
+/*-----------------------------------------------------------*/
+
+    void * pvPortMallocFromBank( UBaseType_t uxBank,
+                                 size_t xSize )
+    {
+        void * pvReturn = NULL;
+        uint8_t * pucArena;
+        size_t * pxUsed = NULL;
+        size_t xArenaSize = 0;
+
+        if( uxBank == portRP2040_BANK_STRIPED )
+        {
+            #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+                pvReturn = pvPortMalloc( xSize );
+            #endif
+        }
+        else
+        {
+            pucArena = prvGetBankArena( uxBank, &pxUsed, &xArenaSize );
+
+            if( ( pucArena != NULL ) && ( xSize > 0 ) && ( xSize <= xArenaSize ) )
+            {
+                xSize = portRP2040_BANK_ARENA_ALIGN( xSize );
+
+                portENTER_CRITICAL();
+                {
+                    if( xSize <= ( xArenaSize - *pxUsed ) )
+                    {
+                        pvReturn = &( pucArena[ *pxUsed ] );
+                        *pxUsed += xSize;
+                    }
+                }
+                portEXIT_CRITICAL();
+            }
+        }
+
+        return pvReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xPortGetFreeBankSize( UBaseType_t uxBank )
+    {
+        size_t * pxUsed = NULL;
+        size_t xArenaSize = 0;
+        size_t xReturn = 0;
+
+        if( prvGetBankArena( uxBank, &pxUsed, &xArenaSize ) != NULL )
+        {
+            xReturn = xArenaSize - *pxUsed;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xPortTaskCreateInBank( TaskFunction_t pxTaskCode,
+                                      const char * const pcName,
+                                      const configSTACK_DEPTH_TYPE uxStackDepth,
+                                      void * const pvParameters,
+                                      UBaseType_t uxPriority,
+                                      UBaseType_t uxBank,
+                                      TaskHandle_t * const pxCreatedTask )
+    {
+        BaseType_t xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+        TaskHandle_t xHandle = NULL;
+        StaticTask_t * pxTaskBuffer = NULL;
+        StackType_t * pxStackBuffer = NULL;
+        const size_t xTaskBufferSize = portRP2040_BANK_ARENA_ALIGN( sizeof( StaticTask_t ) );
+        const size_t xStackBufferSize = ( size_t ) uxStackDepth * sizeof( StackType_t );
+
+        if( uxBank != portRP2040_BANK_STRIPED )
+        {
+            /* Check the bank can hold both buffers before taking either, so a
+             * failed create does not leak arena space that can never be
+             * reclaimed. */
+            portENTER_CRITICAL();
+            {
+                if( xPortGetFreeBankSize( uxBank ) >= ( xTaskBufferSize + portRP2040_BANK_ARENA_ALIGN( xStackBufferSize ) ) )
+                {
+                    pxTaskBuffer = ( StaticTask_t * ) pvPortMallocFromBank( uxBank, xTaskBufferSize );
+                    pxStackBuffer = ( StackType_t * ) pvPortMallocFromBank( uxBank, xStackBufferSize );
+                }
+            }
+            portEXIT_CRITICAL();
+        }
+
+        if( ( pxTaskBuffer != NULL ) && ( pxStackBuffer != NULL ) )
+        {
+            xHandle = xTaskCreateStatic( pxTaskCode, pcName, uxStackDepth, pvParameters, uxPriority, pxStackBuffer, pxTaskBuffer );
+
+            if( xHandle != NULL )
+            {
+                xReturn = pdPASS;
+            }
+
+            if( pxCreatedTask != NULL )
+            {
+                *pxCreatedTask = xHandle;
+            }
+        }
+        else
+        {
+            #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+                xReturn = xTaskCreate( pxTaskCode, pcName, uxStackDepth, pvParameters, uxPriority, pxCreatedTask );
+            #endif
+        }
+
+        return xReturn;
+    }
+#endif /* configUSE_RP2040_BANKED_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_RP2040_CORE_CHANNEL == 1 )
+    #if ( configNUMBER_OF_CORES == 1 ) || ( LIB_PICO_MULTICORE != 1 ) || ( configSUPPORT_PICO_SYNC_INTEROP != 1 )
+        #error configUSE_RP2040_CORE_CHANNEL requires the scheduler to run on both cores, with pico_multicore and pico_sync linked
+    #endif
+
+    #if ( configTASK_NOTIFICATION_ARRAY_ENTRIES < 2 )
+        #error configUSE_RP2040_CORE_CHANNEL requires configTASK_NOTIFICATION_ARRAY_ENTRIES to be at least 2, so notification index 0 remains free for the application
+    #endif
+
+    #if ( ( configRP2040_CORE_CHANNEL_LENGTH & ( configRP2040_CORE_CHANNEL_LENGTH - 1 ) ) != 0 )
+        #error configRP2040_CORE_CHANNEL_LENGTH must be a power of two
+    #endif
+
+/* The channel into a core.  ulHead is only written by that core's FIFO
+ * interrupt, ulTail only by the receiving task, and ulSent only by the other
+ * core with its interrupts masked.  All three are free running, so
+ * ( ulSent - ulTail ) is the number of messages the receiving task has yet to
+ * take, including those still in the hardware FIFO, and the sender keeps it
+ * within the buffer length. */
+    typedef struct CoreChannel
+    {
+        volatile uint32_t ulHead;
+        volatile uint32_t ulTail;
+        volatile uint32_t ulSent;
+        TaskHandle_t volatile xReceiver; /* Set while a task waits for a message. */
+        TaskHandle_t volatile xSender;   /* Set while a task waits for space. */
+        uint32_t ulMessages[ configRP2040_CORE_CHANNEL_LENGTH ];
+    } CoreChannel_t;
+
+    static CoreChannel_t xCoreChannels[ configNUMBER_OF_CORES ];
+
+    #define portCORE_CHANNEL_INDEX_MASK    ( ( uint32_t ) configRP2040_CORE_CHANNEL_LENGTH - 1UL )
+
+/* Outcomes of prvCoreChannelTryWrite(). */
+    #define portCORE_CHANNEL_WRITTEN      ( 0 )
+    #define portCORE_CHANNEL_FULL         ( 1 )
+    #define portCORE_CHANNEL_FIFO_FULL    ( 2 )
+
+    static void prvCoreChannelDrainFIFO( void )
+    {
+        CoreChannel_t * const pxChannel = &( xCoreChannels[ get_core_num() ] );
+        uint32_t ulHead = pxChannel->ulHead;
+        uint32_t ulWord;
+        TaskHandle_t xReceiver;
+
+        while( multicore_fifo_rvalid() )
+        {
+            ulWord = sio_hw->fifo_rd;
+
+            if( ulWord != portRP2040_CORE_CHANNEL_RESERVED_MESSAGE )
+            {
+                /* The sender never has more messages in flight than the
+                 * buffer holds. */
+                configASSERT( ( ulHead - pxChannel->ulTail ) < ( uint32_t ) configRP2040_CORE_CHANNEL_LENGTH );
+                pxChannel->ulMessages[ ulHead & portCORE_CHANNEL_INDEX_MASK ] = ulWord;
+                ulHead++;
+            }
+        }
+
+        if( ulHead != pxChannel->ulHead )
+        {
+            /* Publish the messages before looking for a task to wake, so a
+             * receiver that registers after this load sees them when it checks
+             * again. */
+            __dmb();
+            pxChannel->ulHead = ulHead;
+            __dmb();
+
+            xReceiver = pxChannel->xReceiver;
+
+            if( xReceiver != NULL )
+            {
+                /* The FIFO interrupt handler always yields afterwards. */
+                vTaskNotifyGiveIndexedFromISR( xReceiver, configRP2040_CORE_CHANNEL_NOTIFY_INDEX, NULL );
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+/* Writes ulMessage to the other core's FIFO if its channel has room for it.
+ * Interrupts are masked so that a yield request or a message sent from an
+ * interrupt on this core cannot take the FIFO slot between the check and the
+ * write.  A full FIFO is reported rather than waited for here, as the other
+ * core may itself be waiting, with its interrupts masked, for this core to
+ * empty the FIFO in the opposite direction. */
+    static BaseType_t prvCoreChannelTryWrite( uint32_t ulMessage )
+    {
+        CoreChannel_t * pxChannel;
+        BaseType_t xResult;
+        uint32_t ulState;
+
+        ulState = portSET_INTERRUPT_MASK();
+        {
+            pxChannel = &( xCoreChannels[ 1U - get_core_num() ] );
+
+            if( ( pxChannel->ulSent - pxChannel->ulTail ) >= ( uint32_t ) configRP2040_CORE_CHANNEL_LENGTH )
+            {
+                xResult = portCORE_CHANNEL_FULL;
+            }
+            else if( !multicore_fifo_wready() )
+            {
+                xResult = portCORE_CHANNEL_FIFO_FULL;
+            }
+            else
+            {
+                pxChannel->ulSent++;
+                sio_hw->fifo_wr = ulMessage;
+                __sev();
+                xResult = portCORE_CHANNEL_WRITTEN;
+            }
+        }
+        portCLEAR_INTERRUPT_MASK( ulState );
+
+        return xResult;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xPortCoreChannelSend( uint32_t ulMessage,
+                                     TickType_t xTicksToWait )
+    {
+        CoreChannel_t * pxChannel;
+        TimeOut_t xTimeOut;
+        BaseType_t xResult;
+        BaseType_t xReturn = errQUEUE_FULL;
+
+        configASSERT( ulMessage != portRP2040_CORE_CHANNEL_RESERVED_MESSAGE );
+        configASSERT( !portCHECK_IF_IN_ISR() );
+
+        vTaskSetTimeOutState( &xTimeOut );
+
+        for( ; ; )
+        {
+            xResult = prvCoreChannelTryWrite( ulMessage );
+
+            if( xResult == portCORE_CHANNEL_WRITTEN )
+            {
+                xReturn = pdPASS;
+                break;
+            }
+            else if( xResult == portCORE_CHANNEL_FIFO_FULL )
+            {
+                /* The other core empties its FIFO as soon as it can take its
+                 * FIFO interrupt, so this is only ever a short wait. */
+                tight_loop_contents();
+            }
+            else if( xTicksToWait == ( TickType_t ) 0 )
+            {
+                break;
+            }
+            else
+            {
+                pxChannel = &( xCoreChannels[ 1U - get_core_num() ] );
+                configASSERT( ( pxChannel->xSender == NULL ) || ( pxChannel->xSender == xTaskGetCurrentTaskHandle() ) );
+
+                /* Register before checking for space again, so a message taken
+                 * after the check below notifies this task. */
+                pxChannel->xSender = xTaskGetCurrentTaskHandle();
+                __dmb();
+
+                if( ( pxChannel->ulSent - pxChannel->ulTail ) < ( uint32_t ) configRP2040_CORE_CHANNEL_LENGTH )
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+                else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+                {
+                    pxChannel->xSender = NULL;
+                    break;
+                }
+                else
+                {
+                    ( void ) ulTaskNotifyTakeIndexed( configRP2040_CORE_CHANNEL_NOTIFY_INDEX, pdTRUE, xTicksToWait );
+                }
+
+                pxChannel->xSender = NULL;
+            }
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xPortCoreChannelSendFromISR( uint32_t ulMessage )
+    {
+        configASSERT( ulMessage != portRP2040_CORE_CHANNEL_RESERVED_MESSAGE );
+
+        return ( prvCoreChannelTryWrite( ulMessage ) == portCORE_CHANNEL_WRITTEN ) ? pdPASS : errQUEUE_FULL;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xPortCoreChannelReceive( uint32_t * pulMessage,
+                                        TickType_t xTicksToWait )
+    {
+        /* The channel is chosen once, so a task that moves to the other core
+         * while blocked keeps receiving from the channel it started on. */
+        CoreChannel_t * const pxChannel = &( xCoreChannels[ get_core_num() ] );
+        TimeOut_t xTimeOut;
+        TaskHandle_t xSender;
+        uint32_t ulTail;
+        BaseType_t xReturn = errQUEUE_EMPTY;
+
+        configASSERT( pulMessage );
+        configASSERT( !portCHECK_IF_IN_ISR() );
+        configASSERT( ( pxChannel->xReceiver == NULL ) || ( pxChannel->xReceiver == xTaskGetCurrentTaskHandle() ) );
+
+        vTaskSetTimeOutState( &xTimeOut );
+
+        for( ; ; )
+        {
+            ulTail = pxChannel->ulTail;
+
+            if( pxChannel->ulHead != ulTail )
+            {
+                pxChannel->xReceiver = NULL;
+
+                /* Read the message before releasing its slot. */
+                __dmb();
+                *pulMessage = pxChannel->ulMessages[ ulTail & portCORE_CHANNEL_INDEX_MASK ];
+                __dmb();
+                pxChannel->ulTail = ulTail + 1UL;
+                __dmb();
+
+                xSender = pxChannel->xSender;
+
+                if( xSender != NULL )
+                {
+                    ( void ) xTaskNotifyGiveIndexed( xSender, configRP2040_CORE_CHANNEL_NOTIFY_INDEX );
+                }
+
+                xReturn = pdPASS;
+                break;
+            }
+            else if( xTicksToWait == ( TickType_t ) 0 )
+            {
+                break;
+            }
+            else
+            {
+                /* Register before checking for a message again, so a message
+                 * published after the check below notifies this task. */
+                pxChannel->xReceiver = xTaskGetCurrentTaskHandle();
+                __dmb();
+
+                if( pxChannel->ulHead != ulTail )
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+                else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+                {
+                    pxChannel->xReceiver = NULL;
+                    break;
+                }
+                else
+                {
+                    /* A notification left over from a message that was already
+                     * taken just causes one extra pass. */
+                    ( void ) ulTaskNotifyTakeIndexed( configRP2040_CORE_CHANNEL_NOTIFY_INDEX, pdTRUE, xTicksToWait );
+                }
+            }
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_RP2040_CORE_CHANNEL */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_RP2040_CRITICAL_STATS == 1 )
+    #include <string.h>
+    #include "hardware/structs/timer.h"
+    #include "rp2040_critical_stats.h"
+
+    #if ( INCLUDE_xTaskGetCurrentTaskHandle != 1 )
+        #error configUSE_RP2040_CRITICAL_STATS requires INCLUDE_xTaskGetCurrentTaskHandle to be set to 1
+    #endif
+
+/* The period currently being timed on a core.  Only that core touches it,
+ * and only with interrupts masked. */
+    typedef struct CriticalTiming
+    {
+        uint32_t ulStartUs;
+        const void * pvSite;
+        BaseType_t xTiming;    /* pdTRUE from masking to unmasking. */
+        BaseType_t xSiteNamed; /* pdTRUE once the critical section macro has named the site. */
+    } CriticalTiming_t;
+
+    static CriticalTiming_t xCriticalTimings[ portMAX_CORE_COUNT ];
+    static PortCriticalStats_t xCriticalStats[ configNUMBER_OF_CORES ];
+
+    static void prvUpdateCriticalEntry( PortCriticalEntryStats_t * pxEntry,
+                                        uint32_t ulElapsedUs )
+    {
+        uint32_t ulBucket = 0;
+
+        while( ( ulElapsedUs >> ulBucket ) != 0UL )
+        {
+            ulBucket++;
+        }
+
+        if( ulBucket >= ( uint32_t ) configRP2040_CRITICAL_STATS_BUCKETS )
+        {
+            ulBucket = ( uint32_t ) configRP2040_CRITICAL_STATS_BUCKETS - 1UL;
+        }
+
+        pxEntry->ulCount++;
+        pxEntry->ulHistogram[ ulBucket ]++;
+
+        if( ulElapsedUs > pxEntry->ulMaxUs )
+        {
+            pxEntry->ulMaxUs = ulElapsedUs;
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvRecordCriticalPeriod( const void * pvSite,
+                                         uint32_t ulElapsedUs )
+    {
+        PortCriticalStats_t * const pxStats = &( xCriticalStats[ portGET_CORE_ID() ] );
+        PortCriticalEntryStats_t * pxEntry = NULL;
+        TaskHandle_t xTask = NULL;
+        UBaseType_t x;
+
+        if( ( pxStats->xTotal.ulCount == 0UL ) || ( ulElapsedUs > pxStats->xTotal.ulMaxUs ) )
+        {
+            pxStats->xTotal.pvKey = pvSite;
+        }
+
+        prvUpdateCriticalEntry( &( pxStats->xTotal ), ulElapsedUs );
+
+        for( x = 0; x < ( UBaseType_t ) configRP2040_CRITICAL_STATS_SITES; x++ )
+        {
+            if( ( pxStats->xSites[ x ].pvKey == pvSite ) || ( pxStats->xSites[ x ].pvKey == NULL ) )
+            {
+                pxEntry = &( pxStats->xSites[ x ] );
+                pxEntry->pvKey = pvSite;
+                break;
+            }
+        }
+
+        if( pxEntry != NULL )
+        {
+            prvUpdateCriticalEntry( pxEntry, ulElapsedUs );
+            pxEntry = NULL;
+        }
+        else
+        {
+            pxStats->ulUntrackedSites++;
+        }
+
+        /* Interrupts are still masked, so the nested masking done by
+         * xTaskGetCurrentTaskHandle() is not timed separately. */
+        if( !portCHECK_IF_IN_ISR() )
+        {
+            xTask = xTaskGetCurrentTaskHandle();
+        }
+
+        for( x = 0; x < ( UBaseType_t ) configRP2040_CRITICAL_STATS_TASKS; x++ )
+        {
+            if( ( pxStats->xTasks[ x ].ulCount == 0UL ) || ( pxStats->xTasks[ x ].pvKey == ( const void * ) xTask ) )
+            {
+                pxEntry = &( pxStats->xTasks[ x ] );
+                pxEntry->pvKey = ( const void * ) xTask;
+                break;
+            }
+        }
+
+        if( pxEntry != NULL )
+        {
+            prvUpdateCriticalEntry( pxEntry, ulElapsedUs );
+        }
+        else
+        {
+            pxStats->ulUntrackedTasks++;
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    __attribute__( ( noinline ) ) uint32_t ulPortCriticalStatsMask( void )
+    {
+        CriticalTiming_t * pxTiming;
+        uint32_t ulState;
+
+        __asm volatile ( "mrs %0, PRIMASK" : "=r" ( ulState )::);
+        __asm volatile ( " cpsid i " ::: "memory" );
+
+        if( ulState == 0UL )
+        {
+            pxTiming = &( xCriticalTimings[ get_core_num() ] );
+            pxTiming->pvSite = __builtin_return_address( 0 );
+            pxTiming->xSiteNamed = pdFALSE;
+            pxTiming->xTiming = pdTRUE;
+            pxTiming->ulStartUs = timer_hw->timerawl;
+        }
+
+        return ulState;
+    }
+/*-----------------------------------------------------------*/
+
+    __attribute__( ( noinline ) ) void vPortCriticalStatsUnmask( uint32_t ulState )
+    {
+        CriticalTiming_t * pxTiming;
+        uint32_t ulElapsedUs;
+        uint32_t ulMasked;
+
+        __asm volatile ( "mrs %0, PRIMASK" : "=r" ( ulMasked )::);
+
+        if( ( ulState == 0UL ) && ( ulMasked != 0UL ) )
+        {
+            ulElapsedUs = timer_hw->timerawl;
+            pxTiming = &( xCriticalTimings[ get_core_num() ] );
+
+            /* Periods started by masking the port did not see, such as the
+             * SDK's, are ignored. */
+            if( pxTiming->xTiming != pdFALSE )
+            {
+                pxTiming->xTiming = pdFALSE;
+                ulElapsedUs -= pxTiming->ulStartUs;
+
+                if( portIS_FREE_RTOS_CORE() )
+                {
+                    prvRecordCriticalPeriod( pxTiming->pvSite, ulElapsedUs );
+                }
+            }
+        }
+
+        __asm volatile ( "msr PRIMASK,%0" ::"r" ( ulState ) : "memory" );
+    }
+/*-----------------------------------------------------------*/
+
+    __attribute__( ( noinline ) ) void vPortCriticalStatsNameSite( void )
+    {
+        CriticalTiming_t * const pxTiming = &( xCriticalTimings[ get_core_num() ] );
+
+        /* Called with interrupts masked by the critical section just entered.
+         * Only the outermost critical section of a period names its site. */
+        if( ( pxTiming->xTiming != pdFALSE ) && ( pxTiming->xSiteNamed == pdFALSE ) )
+        {
+            pxTiming->pvSite = __builtin_return_address( 0 );
+            pxTiming->xSiteNamed = pdTRUE;
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortGetCriticalStats( BaseType_t xCoreID,
+                                PortCriticalStats_t * pxStats )
+    {
+        uint32_t ulState;
+
+        configASSERT( ( xCoreID >= 0 ) && ( xCoreID < configNUMBER_OF_CORES ) );
+        configASSERT( pxStats );
+
+        ulState = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            *pxStats = xCriticalStats[ xCoreID ];
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( ulState );
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortResetCriticalStats( void )
+    {
+        uint32_t ulState;
+
+        ulState = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            ( void ) memset( &( xCriticalStats[ portGET_CORE_ID() ] ), 0x00, sizeof( PortCriticalStats_t ) );
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( ulState );
+    }
+
+#endif /* configUSE_RP2040_CRITICAL_STATS */
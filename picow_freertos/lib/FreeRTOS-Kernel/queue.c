@@ -53,6 +53,32 @@
 #define queueLOCKED_UNMODIFIED    ( ( int8_t ) 0 )
 #define queueINT8_MAX             ( ( int8_t ) 127 )
 
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+/* Bits used in the ucZeroCopyState structure member.  RESERVED and ACQUIRED
+ * record a slot handed out by xQueueReserve() or xQueueAcquire().  The
+ * WAITING bits record that a task blocked only because of such a slot, so it
+ * must be rechecked when the slot is committed or released rather than waiting
+ * for the queue to become non-full or non-empty. */
+    #define queueZERO_COPY_RESERVED         ( ( uint8_t ) 0x01U )
+    #define queueZERO_COPY_ACQUIRED         ( ( uint8_t ) 0x02U )
+    #define queueZERO_COPY_SEND_WAITING     ( ( uint8_t ) 0x04U )
+    #define queueZERO_COPY_RECEIVE_WAITING  ( ( uint8_t ) 0x08U )
+
+/* A reserved slot is the next one written to, so it holds back every send.
+ * An acquired item is the next one read from, so it holds back every receive
+ * and peek, and any send that would write over it - that is, a send to the
+ * front of the queue or an overwrite. */
+    #define queueIS_SEND_HELD( pxQueue, xCopyPosition )                               \
+    ( ( ( ( pxQueue )->ucZeroCopyState & queueZERO_COPY_RESERVED ) != 0U ) ||         \
+      ( ( ( ( pxQueue )->ucZeroCopyState & queueZERO_COPY_ACQUIRED ) != 0U ) &&       \
+        ( ( xCopyPosition ) != queueSEND_TO_BACK ) ) )
+    #define queueIS_RECEIVE_HELD( pxQueue )    ( ( ( pxQueue )->ucZeroCopyState & queueZERO_COPY_ACQUIRED ) != 0U )
+#else
+    #define queueIS_SEND_HELD( pxQueue, xCopyPosition )    ( pdFALSE )
+    #define queueIS_RECEIVE_HELD( pxQueue )                ( pdFALSE )
+#endif /* configUSE_QUEUE_ZERO_COPY */
+
 /* When the Queue_t structure is used to represent a base queue its pcHead and
  * pcTail members are used as pointers into the queue storage area.  When the
  * Queue_t structure is used to represent a mutex pcHead and pcTail pointers are
@@ -125,6 +151,12 @@ typedef struct QueueDefinition /* The old naming convention is used to prevent b
         uint8_t ucStaticallyAllocated; /**< Set to pdTRUE if the memory used by the queue was statically allocated to ensure no attempt is made to free the memory. */
     #endif
 
+    #if ( configUSE_QUEUE_ZERO_COPY == 1 )
+        uint8_t ucZeroCopyState;       /**< queueZERO_COPY_* bits recording an outstanding xQueueReserve()/xQueueAcquire() and the tasks held back by it. */
+        TaskHandle_t xZeroCopyReserver; /**< The task holding the reserved slot, the only one that may commit it. */
+        TaskHandle_t xZeroCopyAcquirer; /**< The task holding the acquired item, the only one that may release it. */
+    #endif
+
     #if ( configUSE_QUEUE_SETS == 1 )
         struct QueueDefinition * pxQueueSetContainer;
     #endif
@@ -219,6 +251,69 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue,
     static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 #endif
 
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+/*
+ * Called with the scheduler suspended by a task that found it has to block.
+ * Returns pdTRUE if the only reason is a slot handed out by xQueueReserve() or
+ * xQueueAcquire(), in which case it also marks the queue so the slot's commit
+ * or release unblocks every task waiting on that side of the queue.
+ */
+    static BaseType_t prvIsSendHeld( Queue_t * const pxQueue,
+                                     const BaseType_t xCopyPosition ) PRIVILEGED_FUNCTION;
+    static BaseType_t prvIsReceiveHeld( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Removes every task from pxEventList.  Returns pdTRUE if any of them should
+ * preempt the calling task.
+ */
+    static BaseType_t prvRemoveAllFromEventList( List_t * const pxEventList ) PRIVILEGED_FUNCTION;
+#else
+    #define prvIsSendHeld( pxQueue, xCopyPosition )    ( pdFALSE )
+    #define prvIsReceiveHeld( pxQueue )                ( pdFALSE )
+#endif /* configUSE_QUEUE_ZERO_COPY */
+
+#if ( configUSE_QUEUE_HAND_OFF == 1 )
+
+/*
+ * Called from a critical section with the queue unlocked.  If the queue is
+ * empty and the highest priority task waiting to receive is blocked in
+ * xQueueReceive(), the item is copied straight into that task's buffer and the
+ * task is unblocked without the item ever entering the queue storage area.
+ * Returns pdTRUE if the item was handed off, and sets
+ * *pxHigherPriorityTaskWoken to pdTRUE if the unblocked task should preempt
+ * the calling task.
+ */
+    static BaseType_t prvHandOffToWaitingReceiver( Queue_t * const pxQueue,
+                                                   const void * pvItemToQueue,
+                                                   BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#else
+    #define prvHandOffToWaitingReceiver( pxQueue, pvItemToQueue, pxHigherPriorityTaskWoken )    ( pdFALSE )
+#endif /* configUSE_QUEUE_HAND_OFF */
+
+#if ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 )
+
+/*
+ * Copy uxItemCount items into the back of the queue, or out of the front of
+ * the queue, using one memcpy() for each side of the point where the storage
+ * area wraps.  The caller must already have checked there is enough space, or
+ * enough items.
+ */
+    static void prvCopyMultipleToQueue( Queue_t * const pxQueue,
+                                        const void * pvItems,
+                                        const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+    static void prvCopyMultipleFromQueue( Queue_t * const pxQueue,
+                                          void * pvBuffer,
+                                          const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Removes up to uxMaxTasks tasks from pxEventList.  Returns pdTRUE if any of
+ * them should preempt the calling task.
+ */
+    static BaseType_t prvRemoveMultipleFromEventList( List_t * const pxEventList,
+                                                      UBaseType_t uxMaxTasks ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_QUEUE_MULTIPLE_ITEMS */
+
 /*
  * Called after a Queue_t structure has been allocated either statically or
  * dynamically to fill in the structure's members.
@@ -249,6 +344,26 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
  */
     static UBaseType_t prvGetHighestPriorityOfWaitToReceiveList( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 #endif
+
+/* On SMP builds a task that finds a mutex taken can poll it, for up to
+ * configMUTEX_SPIN_ITERATIONS passes, while the holder is running on another
+ * core, instead of paying for a context switch each way. */
+#if ( ( configUSE_MUTEXES == 1 ) && ( configNUMBER_OF_CORES > 1 ) && ( configMUTEX_SPIN_ITERATIONS > 0 ) )
+    #define queueUSE_MUTEX_SPIN    1
+#else
+    #define queueUSE_MUTEX_SPIN    0
+#endif
+
+#if ( queueUSE_MUTEX_SPIN == 1 )
+
+/*
+ * Polls the mutex without entering a critical section until it is given, its
+ * holder stops running on another core, or *puxSpinsLeft passes have been
+ * used.  Returns pdTRUE if the mutex was seen to be available.
+ */
+    static BaseType_t prvSpinWhileMutexHolderRuns( const Queue_t * const pxQueue,
+                                                   UBaseType_t * const puxSpinsLeft ) PRIVILEGED_FUNCTION;
+#endif
 /*-----------------------------------------------------------*/
 
 /*
@@ -324,6 +439,14 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
             pxQueue->cRxLock = queueUNLOCKED;
             pxQueue->cTxLock = queueUNLOCKED;
 
+            #if ( configUSE_QUEUE_ZERO_COPY == 1 )
+            {
+                pxQueue->ucZeroCopyState = 0U;
+                pxQueue->xZeroCopyReserver = NULL;
+                pxQueue->xZeroCopyAcquirer = NULL;
+            }
+            #endif
+
             if( xNewQueue == pdFALSE )
             {
                 /* If there are tasks blocked waiting to read from the queue, then
@@ -526,7 +649,7 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
             /* MISRA Ref 11.5.1 [Malloc memory assignment] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
             /* coverity[misra_c_2012_rule_11_5_violation] */
-            pxNewQueue = ( Queue_t * ) pvPortMalloc( sizeof( Queue_t ) + xQueueSizeInBytes );
+            pxNewQueue = ( Queue_t * ) pvPortMallocKernelObject( sizeof( Queue_t ) + xQueueSizeInBytes );
 
             if( pxNewQueue != NULL )
             {
@@ -974,10 +1097,39 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
              * highest priority task wanting to access the queue.  If the head item
              * in the queue is to be overwritten then it does not matter if the
              * queue is full. */
-            if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+            if( ( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) ) &&
+                ( queueIS_SEND_HELD( pxQueue, xCopyPosition ) == pdFALSE ) )
             {
                 traceQUEUE_SEND( pxQueue );
 
+                #if ( configUSE_QUEUE_HAND_OFF == 1 )
+                {
+                    BaseType_t xHandOffWoken = pdFALSE;
+
+                    if( prvHandOffToWaitingReceiver( pxQueue, pvItemToQueue, &xHandOffWoken ) != pdFALSE )
+                    {
+                        if( xHandOffWoken != pdFALSE )
+                        {
+                            queueYIELD_IF_USING_PREEMPTION();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        taskEXIT_CRITICAL();
+
+                        traceRETURN_xQueueGenericSend( pdPASS );
+
+                        return pdPASS;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* configUSE_QUEUE_HAND_OFF */
+
                 #if ( configUSE_QUEUE_SETS == 1 )
                 {
                     const UBaseType_t uxPreviousMessagesWaiting = pxQueue->uxMessagesWaiting;
@@ -1120,7 +1272,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
         /* Update the timeout state to see if it has expired yet. */
         if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
         {
-            if( prvIsQueueFull( pxQueue ) != pdFALSE )
+            if( ( prvIsQueueFull( pxQueue ) != pdFALSE ) || ( prvIsSendHeld( pxQueue, xCopyPosition ) != pdFALSE ) )
             {
                 traceBLOCKING_ON_QUEUE_SEND( pxQueue );
                 vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
@@ -1205,43 +1357,59 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
     /* coverity[misra_c_2012_directive_4_7_violation] */
     uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
     {
-        if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+        if( ( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) ) &&
+            ( queueIS_SEND_HELD( pxQueue, xCopyPosition ) == pdFALSE ) )
         {
             const int8_t cTxLock = pxQueue->cTxLock;
             const UBaseType_t uxPreviousMessagesWaiting = pxQueue->uxMessagesWaiting;
 
             traceQUEUE_SEND_FROM_ISR( pxQueue );
 
-            /* Semaphores use xQueueGiveFromISR(), so pxQueue will not be a
-             *  semaphore or mutex.  That means prvCopyDataToQueue() cannot result
-             *  in a task disinheriting a priority and prvCopyDataToQueue() can be
-             *  called here even though the disinherit function does not check if
-             *  the scheduler is suspended before accessing the ready lists. */
-            ( void ) prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
-
-            /* The event list is not altered if the queue is locked.  This will
-             * be done when the queue is unlocked later. */
-            if( cTxLock == queueUNLOCKED )
+            /* The event lists are only accessed while the queue is unlocked,
+             * so that is the only time the item can be handed straight to a
+             * task blocked in xQueueReceive(). */
+            if( ( cTxLock == queueUNLOCKED ) &&
+                ( prvHandOffToWaitingReceiver( pxQueue, pvItemToQueue, pxHigherPriorityTaskWoken ) != pdFALSE ) )
             {
-                #if ( configUSE_QUEUE_SETS == 1 )
+                mtCOVERAGE_TEST_MARKER();
+            }
+            else
+            {
+                /* Semaphores use xQueueGiveFromISR(), so pxQueue will not be a
+                 *  semaphore or mutex.  That means prvCopyDataToQueue() cannot result
+                 *  in a task disinheriting a priority and prvCopyDataToQueue() can be
+                 *  called here even though the disinherit function does not check if
+                 *  the scheduler is suspended before accessing the ready lists. */
+                ( void ) prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
+
+                /* The event list is not altered if the queue is locked.  This will
+                 * be done when the queue is unlocked later. */
+                if( cTxLock == queueUNLOCKED )
                 {
-                    if( pxQueue->pxQueueSetContainer != NULL )
+                    #if ( configUSE_QUEUE_SETS == 1 )
                     {
-                        if( ( xCopyPosition == queueOVERWRITE ) && ( uxPreviousMessagesWaiting != ( UBaseType_t ) 0 ) )
-                        {
-                            /* Do not notify the queue set as an existing item
-                             * was overwritten in the queue so the number of items
-                             * in the queue has not changed. */
-                            mtCOVERAGE_TEST_MARKER();
-                        }
-                        else if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
+                        if( pxQueue->pxQueueSetContainer != NULL )
                         {
-                            /* The queue is a member of a queue set, and posting
-                             * to the queue set caused a higher priority task to
-                             * unblock.  A context switch is required. */
-                            if( pxHigherPriorityTaskWoken != NULL )
+                            if( ( xCopyPosition == queueOVERWRITE ) && ( uxPreviousMessagesWaiting != ( UBaseType_t ) 0 ) )
                             {
-                                *pxHigherPriorityTaskWoken = pdTRUE;
+                                /* Do not notify the queue set as an existing item
+                                 * was overwritten in the queue so the number of items
+                                 * in the queue has not changed. */
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                            else if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
+                            {
+                                /* The queue is a member of a queue set, and posting
+                                 * to the queue set caused a higher priority task to
+                                 * unblock.  A context switch is required. */
+                                if( pxHigherPriorityTaskWoken != NULL )
+                                {
+                                    *pxHigherPriorityTaskWoken = pdTRUE;
+                                }
+                                else
+                                {
+                                    mtCOVERAGE_TEST_MARKER();
+                                }
                             }
                             else
                             {
@@ -1250,20 +1418,20 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
                         }
                         else
                         {
-                            mtCOVERAGE_TEST_MARKER();
-                        }
-                    }
-                    else
-                    {
-                        if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
-                        {
-                            if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                            if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                             {
-                                /* The task waiting has a higher priority so
-                                 *  record that a context switch is required. */
-                                if( pxHigherPriorityTaskWoken != NULL )
+                                if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
                                 {
-                                    *pxHigherPriorityTaskWoken = pdTRUE;
+                                    /* The task waiting has a higher priority so
+                                     *  record that a context switch is required. */
+                                    if( pxHigherPriorityTaskWoken != NULL )
+                                    {
+                                        *pxHigherPriorityTaskWoken = pdTRUE;
+                                    }
+                                    else
+                                    {
+                                        mtCOVERAGE_TEST_MARKER();
+                                    }
                                 }
                                 else
                                 {
@@ -1275,23 +1443,23 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
                                 mtCOVERAGE_TEST_MARKER();
                             }
                         }
-                        else
-                        {
-                            mtCOVERAGE_TEST_MARKER();
-                        }
                     }
-                }
-                #else /* configUSE_QUEUE_SETS */
-                {
-                    if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                    #else /* configUSE_QUEUE_SETS */
                     {
-                        if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                        if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                         {
-                            /* The task waiting has a higher priority so record that a
-                             * context switch is required. */
-                            if( pxHigherPriorityTaskWoken != NULL )
+                            if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
                             {
-                                *pxHigherPriorityTaskWoken = pdTRUE;
+                                /* The task waiting has a higher priority so record that a
+                                 * context switch is required. */
+                                if( pxHigherPriorityTaskWoken != NULL )
+                                {
+                                    *pxHigherPriorityTaskWoken = pdTRUE;
+                                }
+                                else
+                                {
+                                    mtCOVERAGE_TEST_MARKER();
+                                }
                             }
                             else
                             {
@@ -1302,22 +1470,18 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
                         {
                             mtCOVERAGE_TEST_MARKER();
                         }
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
 
-                    /* Not used in this path. */
-                    ( void ) uxPreviousMessagesWaiting;
+                        /* Not used in this path. */
+                        ( void ) uxPreviousMessagesWaiting;
+                    }
+                    #endif /* configUSE_QUEUE_SETS */
+                }
+                else
+                {
+                    /* Increment the lock count so the task that unlocks the queue
+                     * knows that data was posted while it was locked. */
+                    prvIncrementQueueTxLock( pxQueue, cTxLock );
                 }
-                #endif /* configUSE_QUEUE_SETS */
-            }
-            else
-            {
-                /* Increment the lock count so the task that unlocks the queue
-                 * knows that data was posted while it was locked. */
-                prvIncrementQueueTxLock( pxQueue, cTxLock );
             }
 
             xReturn = pdPASS;
@@ -1541,7 +1705,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
 
             /* Is there data in the queue now?  To be running the calling task
              * must be the highest priority task wanting to access the queue. */
-            if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+            if( ( uxMessagesWaiting > ( UBaseType_t ) 0 ) && ( queueIS_RECEIVE_HELD( pxQueue ) == pdFALSE ) )
             {
                 /* Data available, remove one item. */
                 prvCopyDataFromQueue( pxQueue, pvBuffer );
@@ -1613,9 +1777,25 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
         {
             /* The timeout has not expired.  If the queue is still empty place
              * the task on the list of tasks waiting to receive from the queue. */
-            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            if( ( prvIsQueueEmpty( pxQueue ) != pdFALSE ) || ( prvIsReceiveHeld( pxQueue ) != pdFALSE ) )
             {
                 traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+
+                #if ( configUSE_QUEUE_HAND_OFF == 1 )
+                {
+                    /* Let a sender that finds this task at the head of the
+                     * event list copy its item straight into pvBuffer. */
+                    if( pxQueue->uxItemSize != ( UBaseType_t ) 0U )
+                    {
+                        vTaskSetQueueHandOffBuffer( pvBuffer );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* configUSE_QUEUE_HAND_OFF */
+
                 vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
                 prvUnlockQueue( pxQueue );
 
@@ -1627,6 +1807,25 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
+
+                #if ( configUSE_QUEUE_HAND_OFF == 1 )
+                {
+                    if( ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) &&
+                        ( xTaskResetQueueHandOffBuffer() != pdFALSE ) )
+                    {
+                        /* A sender copied the item into pvBuffer and unblocked
+                         * this task, so there is nothing left to read. */
+                        traceQUEUE_RECEIVE( pxQueue );
+                        traceRETURN_xQueueReceive( pdPASS );
+
+                        return pdPASS;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* configUSE_QUEUE_HAND_OFF */
             }
             else
             {
@@ -1670,6 +1869,10 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
         BaseType_t xInheritanceOccurred = pdFALSE;
     #endif
 
+    #if ( queueUSE_MUTEX_SPIN == 1 )
+        UBaseType_t uxSpinsLeft = ( UBaseType_t ) configMUTEX_SPIN_ITERATIONS;
+    #endif
+
     traceENTER_xQueueSemaphoreTake( xQueue, xTicksToWait );
 
     /* Check the queue pointer is not NULL. */
@@ -1772,6 +1975,30 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
         }
         taskEXIT_CRITICAL();
 
+        #if ( queueUSE_MUTEX_SPIN == 1 )
+        {
+            if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+            {
+                if( prvSpinWhileMutexHolderRuns( pxQueue, &uxSpinsLeft ) != pdFALSE )
+                {
+                    /* The holder gave the mutex back while this task was
+                     * spinning, so try to take it again without blocking.  The
+                     * spin budget is for the whole call, so this cannot repeat
+                     * indefinitely. */
+                    continue;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* queueUSE_MUTEX_SPIN */
+
         /* Interrupts and other tasks can give to and take from the semaphore
          * now the critical section has been exited. */
 
@@ -1917,7 +2144,7 @@ BaseType_t xQueuePeek( QueueHandle_t xQueue,
 
             /* Is there data in the queue now?  To be running the calling task
              * must be the highest priority task wanting to access the queue. */
-            if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+            if( ( uxMessagesWaiting > ( UBaseType_t ) 0 ) && ( queueIS_RECEIVE_HELD( pxQueue ) == pdFALSE ) )
             {
                 /* Remember the read position so it can be reset after the data
                  * is read from the queue as this function is only peeking the
@@ -1996,7 +2223,7 @@ BaseType_t xQueuePeek( QueueHandle_t xQueue,
         {
             /* Timeout has not expired yet, check to see if there is data in the
             * queue now, and if not enter the Blocked state to wait for data. */
-            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            if( ( prvIsQueueEmpty( pxQueue ) != pdFALSE ) || ( prvIsReceiveHeld( pxQueue ) != pdFALSE ) )
             {
                 traceBLOCKING_ON_QUEUE_PEEK( pxQueue );
                 vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
@@ -2079,7 +2306,7 @@ BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
         const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
 
         /* Cannot block in an ISR, so check there is data available. */
-        if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+        if( ( uxMessagesWaiting > ( UBaseType_t ) 0 ) && ( queueIS_RECEIVE_HELD( pxQueue ) == pdFALSE ) )
         {
             const int8_t cRxLock = pxQueue->cRxLock;
 
@@ -2178,7 +2405,7 @@ BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,
     uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
     {
         /* Cannot block in an ISR, so check there is data available. */
-        if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+        if( ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 ) && ( queueIS_RECEIVE_HELD( pxQueue ) == pdFALSE ) )
         {
             traceQUEUE_PEEK_FROM_ISR( pxQueue );
 
@@ -2204,66 +2431,829 @@ BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,
 }
 /*-----------------------------------------------------------*/
 
-UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
-{
-    UBaseType_t uxReturn;
-
-    traceENTER_uxQueueMessagesWaiting( xQueue );
-
-    configASSERT( xQueue );
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
 
-    portBASE_TYPE_ENTER_CRITICAL();
+    BaseType_t xQueueReserve( QueueHandle_t xQueue,
+                              void ** const ppvSlot,
+                              TickType_t xTicksToWait )
     {
-        uxReturn = ( ( Queue_t * ) xQueue )->uxMessagesWaiting;
-    }
-    portBASE_TYPE_EXIT_CRITICAL();
-
-    traceRETURN_uxQueueMessagesWaiting( uxReturn );
-
-    return uxReturn;
-}
-/*-----------------------------------------------------------*/
+        BaseType_t xEntryTimeSet = pdFALSE;
+        TimeOut_t xTimeOut;
+        Queue_t * const pxQueue = xQueue;
 
-UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue )
-{
-    UBaseType_t uxReturn;
-    Queue_t * const pxQueue = xQueue;
+        traceENTER_xQueueReserve( xQueue, ppvSlot, xTicksToWait );
 
-    traceENTER_uxQueueSpacesAvailable( xQueue );
+        configASSERT( pxQueue );
+        configASSERT( ppvSlot );
 
-    configASSERT( pxQueue );
+        /* Only queues that store items by copy have slots to hand out. */
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
 
-    portBASE_TYPE_ENTER_CRITICAL();
-    {
-        uxReturn = ( UBaseType_t ) ( pxQueue->uxLength - pxQueue->uxMessagesWaiting );
-    }
-    portBASE_TYPE_EXIT_CRITICAL();
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
 
-    traceRETURN_uxQueueSpacesAvailable( uxReturn );
+        for( ; ; )
+        {
+            taskENTER_CRITICAL();
+            {
+                /* Is there a free slot that is not already reserved? */
+                if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) &&
+                    ( queueIS_SEND_HELD( pxQueue, queueSEND_TO_BACK ) == pdFALSE ) )
+                {
+                    /* Hand out the slot a send to the back of the queue would
+                     * write to.  It only becomes visible to receivers when it
+                     * is committed, and no other send can use it until then. */
+                    pxQueue->ucZeroCopyState |= queueZERO_COPY_RESERVED;
+                    pxQueue->xZeroCopyReserver = xTaskGetCurrentTaskHandle();
+                    *ppvSlot = ( void * ) pxQueue->pcWriteTo;
 
-    return uxReturn;
-}
-/*-----------------------------------------------------------*/
+                    taskEXIT_CRITICAL();
 
-UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue )
-{
-    UBaseType_t uxReturn;
-    Queue_t * const pxQueue = xQueue;
+                    traceRETURN_xQueueReserve( pdPASS );
 
-    traceENTER_uxQueueMessagesWaitingFromISR( xQueue );
+                    return pdPASS;
+                }
+                else
+                {
+                    if( xTicksToWait == ( TickType_t ) 0 )
+                    {
+                        taskEXIT_CRITICAL();
 
-    configASSERT( pxQueue );
-    uxReturn = pxQueue->uxMessagesWaiting;
+                        traceQUEUE_SEND_FAILED( pxQueue );
+                        traceRETURN_xQueueReserve( errQUEUE_FULL );
 
-    traceRETURN_uxQueueMessagesWaitingFromISR( uxReturn );
+                        return errQUEUE_FULL;
+                    }
+                    else if( xEntryTimeSet == pdFALSE )
+                    {
+                        vTaskInternalSetTimeOutState( &xTimeOut );
+                        xEntryTimeSet = pdTRUE;
+                    }
+                    else
+                    {
+                        /* Entry time was already set. */
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            taskEXIT_CRITICAL();
 
-    return uxReturn;
-}
-/*-----------------------------------------------------------*/
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
 
-void vQueueDelete( QueueHandle_t xQueue )
-{
-    Queue_t * const pxQueue = xQueue;
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                if( ( prvIsQueueFull( pxQueue ) != pdFALSE ) || ( prvIsSendHeld( pxQueue, queueSEND_TO_BACK ) != pdFALSE ) )
+                {
+                    traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+                    prvUnlockQueue( pxQueue );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        taskYIELD_WITHIN_API();
+                    }
+                }
+                else
+                {
+                    /* Try again. */
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
+                }
+            }
+            else
+            {
+                /* The timeout has expired. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+
+                traceQUEUE_SEND_FAILED( pxQueue );
+                traceRETURN_xQueueReserve( errQUEUE_FULL );
+
+                return errQUEUE_FULL;
+            }
+        }
+    }
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+    BaseType_t xQueueCommit( QueueHandle_t xQueue,
+                             void * const pvSlot )
+    {
+        BaseType_t xReturn = pdFAIL;
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_xQueueCommit( xQueue, pvSlot );
+
+        configASSERT( pxQueue );
+
+        taskENTER_CRITICAL();
+        {
+            /* Only the slot handed out by xQueueReserve() can be committed,
+             * and only by the task it was handed to. */
+            configASSERT( ( pxQueue->ucZeroCopyState & queueZERO_COPY_RESERVED ) != 0U );
+            configASSERT( pvSlot == ( void * ) pxQueue->pcWriteTo );
+            configASSERT( pxQueue->xZeroCopyReserver == xTaskGetCurrentTaskHandle() );
+
+            if( ( ( pxQueue->ucZeroCopyState & queueZERO_COPY_RESERVED ) != 0U ) &&
+                ( pvSlot == ( void * ) pxQueue->pcWriteTo ) )
+            {
+                traceQUEUE_SEND( pxQueue );
+
+                /* The item is already in place, so this is what
+                 * prvCopyDataToQueue() does for queueSEND_TO_BACK without the
+                 * copy. */
+                pxQueue->pcWriteTo += pxQueue->uxItemSize;
+
+                if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail )
+                {
+                    pxQueue->pcWriteTo = pxQueue->pcHead;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( pxQueue->uxMessagesWaiting + ( UBaseType_t ) 1 );
+                pxQueue->ucZeroCopyState &= ( uint8_t ) ~queueZERO_COPY_RESERVED;
+                pxQueue->xZeroCopyReserver = NULL;
+
+                #if ( configUSE_QUEUE_SETS == 1 )
+                    if( pxQueue->pxQueueSetContainer != NULL )
+                    {
+                        if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
+                        {
+                            queueYIELD_IF_USING_PREEMPTION();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                #endif /* configUSE_QUEUE_SETS */
+                {
+                    /* If there was a task waiting for data to arrive on the
+                     * queue then unblock it now. */
+                    if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                    {
+                        if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                        {
+                            queueYIELD_IF_USING_PREEMPTION();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+
+                /* Tasks that blocked only because the slot was reserved can
+                 * try again if there is still space. */
+                if( ( pxQueue->ucZeroCopyState & queueZERO_COPY_SEND_WAITING ) != 0U )
+                {
+                    pxQueue->ucZeroCopyState &= ( uint8_t ) ~queueZERO_COPY_SEND_WAITING;
+
+                    if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) &&
+                        ( prvRemoveAllFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE ) )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_xQueueCommit( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+    BaseType_t xQueueAcquire( QueueHandle_t xQueue,
+                              void ** const ppvItem,
+                              TickType_t xTicksToWait )
+    {
+        BaseType_t xEntryTimeSet = pdFALSE;
+        TimeOut_t xTimeOut;
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_xQueueAcquire( xQueue, ppvItem, xTicksToWait );
+
+        configASSERT( pxQueue );
+        configASSERT( ppvItem );
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        for( ; ; )
+        {
+            taskENTER_CRITICAL();
+            {
+                /* Is there an item that is not already acquired? */
+                if( ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 ) &&
+                    ( queueIS_RECEIVE_HELD( pxQueue ) == pdFALSE ) )
+                {
+                    int8_t * pcItem = pxQueue->u.xQueue.pcReadFrom + pxQueue->uxItemSize;
+
+                    if( pcItem >= pxQueue->u.xQueue.pcTail )
+                    {
+                        pcItem = pxQueue->pcHead;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    /* Hand out the item a receive would copy out.  It stays
+                     * counted in the queue, so its slot cannot be reused,
+                     * until it is released. */
+                    pxQueue->ucZeroCopyState |= queueZERO_COPY_ACQUIRED;
+                    pxQueue->xZeroCopyAcquirer = xTaskGetCurrentTaskHandle();
+                    *ppvItem = ( void * ) pcItem;
+
+                    taskEXIT_CRITICAL();
+
+                    traceRETURN_xQueueAcquire( pdPASS );
+
+                    return pdPASS;
+                }
+                else
+                {
+                    if( xTicksToWait == ( TickType_t ) 0 )
+                    {
+                        taskEXIT_CRITICAL();
+
+                        traceQUEUE_RECEIVE_FAILED( pxQueue );
+                        traceRETURN_xQueueAcquire( errQUEUE_EMPTY );
+
+                        return errQUEUE_EMPTY;
+                    }
+                    else if( xEntryTimeSet == pdFALSE )
+                    {
+                        vTaskInternalSetTimeOutState( &xTimeOut );
+                        xEntryTimeSet = pdTRUE;
+                    }
+                    else
+                    {
+                        /* Entry time was already set. */
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
+
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                if( ( prvIsQueueEmpty( pxQueue ) != pdFALSE ) || ( prvIsReceiveHeld( pxQueue ) != pdFALSE ) )
+                {
+                    traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                    prvUnlockQueue( pxQueue );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        taskYIELD_WITHIN_API();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    /* Try again. */
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
+                }
+            }
+            else
+            {
+                /* Timed out. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+
+                traceQUEUE_RECEIVE_FAILED( pxQueue );
+                traceRETURN_xQueueAcquire( errQUEUE_EMPTY );
+
+                return errQUEUE_EMPTY;
+            }
+        }
+    }
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+    BaseType_t xQueueRelease( QueueHandle_t xQueue,
+                              const void * const pvItem )
+    {
+        BaseType_t xReturn = pdFAIL;
+        Queue_t * const pxQueue = xQueue;
+        int8_t * pcItem;
+
+        traceENTER_xQueueRelease( xQueue, pvItem );
+
+        configASSERT( pxQueue );
+
+        taskENTER_CRITICAL();
+        {
+            pcItem = pxQueue->u.xQueue.pcReadFrom + pxQueue->uxItemSize;
+
+            if( pcItem >= pxQueue->u.xQueue.pcTail )
+            {
+                pcItem = pxQueue->pcHead;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* Only the item handed out by xQueueAcquire() can be released,
+             * and only by the task it was handed to. */
+            configASSERT( ( pxQueue->ucZeroCopyState & queueZERO_COPY_ACQUIRED ) != 0U );
+            configASSERT( pvItem == ( const void * ) pcItem );
+            configASSERT( pxQueue->xZeroCopyAcquirer == xTaskGetCurrentTaskHandle() );
+
+            if( ( ( pxQueue->ucZeroCopyState & queueZERO_COPY_ACQUIRED ) != 0U ) &&
+                ( pvItem == ( const void * ) pcItem ) )
+            {
+                /* As prvCopyDataFromQueue() followed by the removal in
+                 * xQueueReceive(), without the copy. */
+                pxQueue->u.xQueue.pcReadFrom = pcItem;
+                traceQUEUE_RECEIVE( pxQueue );
+                pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( pxQueue->uxMessagesWaiting - ( UBaseType_t ) 1 );
+                pxQueue->ucZeroCopyState &= ( uint8_t ) ~queueZERO_COPY_ACQUIRED;
+                pxQueue->xZeroCopyAcquirer = NULL;
+
+                /* There is now space in the queue.  If a send to the front or
+                 * an overwrite was held back by the acquired item every
+                 * waiting sender is rechecked, otherwise the highest priority
+                 * one is unblocked as for any other receive. */
+                if( ( pxQueue->ucZeroCopyState & queueZERO_COPY_SEND_WAITING ) != 0U )
+                {
+                    pxQueue->ucZeroCopyState &= ( uint8_t ) ~queueZERO_COPY_SEND_WAITING;
+
+                    if( prvRemoveAllFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                {
+                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* Receivers that blocked only because the item was acquired
+                 * can try again if there are more items. */
+                if( ( pxQueue->ucZeroCopyState & queueZERO_COPY_RECEIVE_WAITING ) != 0U )
+                {
+                    pxQueue->ucZeroCopyState &= ( uint8_t ) ~queueZERO_COPY_RECEIVE_WAITING;
+
+                    if( ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 ) &&
+                        ( prvRemoveAllFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE ) )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_xQueueRelease( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 )
+
+    UBaseType_t xQueueSendMultiple( QueueHandle_t xQueue,
+                                    const void * pvItems,
+                                    UBaseType_t uxItemCount,
+                                    TickType_t xTicksToWait )
+    {
+        BaseType_t xEntryTimeSet = pdFALSE;
+        TimeOut_t xTimeOut;
+        UBaseType_t uxItemsSent;
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_xQueueSendMultiple( xQueue, pvItems, uxItemCount, xTicksToWait );
+
+        configASSERT( pxQueue );
+        configASSERT( pvItems );
+        configASSERT( uxItemCount > ( UBaseType_t ) 0U );
+
+        /* Only queues that store items by copy can take a block of items. */
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        for( ; ; )
+        {
+            taskENTER_CRITICAL();
+            {
+                if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) &&
+                    ( queueIS_SEND_HELD( pxQueue, queueSEND_TO_BACK ) == pdFALSE ) )
+                {
+                    uxItemsSent = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+
+                    if( uxItemsSent > uxItemCount )
+                    {
+                        uxItemsSent = uxItemCount;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    traceQUEUE_SEND( pxQueue );
+
+                    prvCopyMultipleToQueue( pxQueue, pvItems, uxItemsSent );
+
+                    #if ( configUSE_QUEUE_SETS == 1 )
+                        if( pxQueue->pxQueueSetContainer != NULL )
+                        {
+                            UBaseType_t uxNotified;
+                            BaseType_t xYieldRequired = pdFALSE;
+
+                            /* The set holds one entry for each item. */
+                            for( uxNotified = 0; uxNotified < uxItemsSent; uxNotified++ )
+                            {
+                                if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
+                                {
+                                    xYieldRequired = pdTRUE;
+                                }
+                                else
+                                {
+                                    mtCOVERAGE_TEST_MARKER();
+                                }
+                            }
+
+                            if( xYieldRequired != pdFALSE )
+                            {
+                                queueYIELD_IF_USING_PREEMPTION();
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                        else
+                    #endif /* configUSE_QUEUE_SETS */
+                    {
+                        /* Each item can satisfy one waiting receiver, so
+                         * unblock up to that many in one pass. */
+                        if( prvRemoveMultipleFromEventList( &( pxQueue->xTasksWaitingToReceive ), uxItemsSent ) != pdFALSE )
+                        {
+                            queueYIELD_IF_USING_PREEMPTION();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+
+                    taskEXIT_CRITICAL();
+
+                    traceRETURN_xQueueSendMultiple( uxItemsSent );
+
+                    return uxItemsSent;
+                }
+                else
+                {
+                    if( xTicksToWait == ( TickType_t ) 0 )
+                    {
+                        taskEXIT_CRITICAL();
+
+                        traceQUEUE_SEND_FAILED( pxQueue );
+                        traceRETURN_xQueueSendMultiple( ( UBaseType_t ) 0U );
+
+                        return ( UBaseType_t ) 0U;
+                    }
+                    else if( xEntryTimeSet == pdFALSE )
+                    {
+                        vTaskInternalSetTimeOutState( &xTimeOut );
+                        xEntryTimeSet = pdTRUE;
+                    }
+                    else
+                    {
+                        /* Entry time was already set. */
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
+
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                if( ( prvIsQueueFull( pxQueue ) != pdFALSE ) || ( prvIsSendHeld( pxQueue, queueSEND_TO_BACK ) != pdFALSE ) )
+                {
+                    traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+                    prvUnlockQueue( pxQueue );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        taskYIELD_WITHIN_API();
+                    }
+                }
+                else
+                {
+                    /* Try again. */
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
+                }
+            }
+            else
+            {
+                /* The timeout has expired. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+
+                traceQUEUE_SEND_FAILED( pxQueue );
+                traceRETURN_xQueueSendMultiple( ( UBaseType_t ) 0U );
+
+                return ( UBaseType_t ) 0U;
+            }
+        }
+    }
+
+#endif /* configUSE_QUEUE_MULTIPLE_ITEMS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 )
+
+    UBaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue,
+                                       void * pvBuffer,
+                                       UBaseType_t uxMaxItems,
+                                       TickType_t xTicksToWait )
+    {
+        BaseType_t xEntryTimeSet = pdFALSE;
+        TimeOut_t xTimeOut;
+        UBaseType_t uxItemsReceived;
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_xQueueReceiveMultiple( xQueue, pvBuffer, uxMaxItems, xTicksToWait );
+
+        configASSERT( pxQueue );
+        configASSERT( pvBuffer );
+        configASSERT( uxMaxItems > ( UBaseType_t ) 0U );
+
+        /* Only queues that store items by copy can give out a block of items. */
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        for( ; ; )
+        {
+            taskENTER_CRITICAL();
+            {
+                if( ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 ) &&
+                    ( queueIS_RECEIVE_HELD( pxQueue ) == pdFALSE ) )
+                {
+                    uxItemsReceived = pxQueue->uxMessagesWaiting;
+
+                    if( uxItemsReceived > uxMaxItems )
+                    {
+                        uxItemsReceived = uxMaxItems;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    prvCopyMultipleFromQueue( pxQueue, pvBuffer, uxItemsReceived );
+                    traceQUEUE_RECEIVE( pxQueue );
+
+                    /* Each freed slot can satisfy one waiting sender, so
+                     * unblock up to that many in one pass. */
+                    if( prvRemoveMultipleFromEventList( &( pxQueue->xTasksWaitingToSend ), uxItemsReceived ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    taskEXIT_CRITICAL();
+
+                    traceRETURN_xQueueReceiveMultiple( uxItemsReceived );
+
+                    return uxItemsReceived;
+                }
+                else
+                {
+                    if( xTicksToWait == ( TickType_t ) 0 )
+                    {
+                        taskEXIT_CRITICAL();
+
+                        traceQUEUE_RECEIVE_FAILED( pxQueue );
+                        traceRETURN_xQueueReceiveMultiple( ( UBaseType_t ) 0U );
+
+                        return ( UBaseType_t ) 0U;
+                    }
+                    else if( xEntryTimeSet == pdFALSE )
+                    {
+                        vTaskInternalSetTimeOutState( &xTimeOut );
+                        xEntryTimeSet = pdTRUE;
+                    }
+                    else
+                    {
+                        /* Entry time was already set. */
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
+
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                if( ( prvIsQueueEmpty( pxQueue ) != pdFALSE ) || ( prvIsReceiveHeld( pxQueue ) != pdFALSE ) )
+                {
+                    traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                    prvUnlockQueue( pxQueue );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        taskYIELD_WITHIN_API();
+                    }
+                }
+                else
+                {
+                    /* Try again. */
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
+                }
+            }
+            else
+            {
+                /* The timeout has expired.  Items may have arrived just as it
+                 * did, so only give up if the queue is still empty. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+
+                if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+                {
+                    traceQUEUE_RECEIVE_FAILED( pxQueue );
+                    traceRETURN_xQueueReceiveMultiple( ( UBaseType_t ) 0U );
+
+                    return ( UBaseType_t ) 0U;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+    }
+
+#endif /* configUSE_QUEUE_MULTIPLE_ITEMS */
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
+{
+    UBaseType_t uxReturn;
+
+    traceENTER_uxQueueMessagesWaiting( xQueue );
+
+    configASSERT( xQueue );
+
+    portBASE_TYPE_ENTER_CRITICAL();
+    {
+        uxReturn = ( ( Queue_t * ) xQueue )->uxMessagesWaiting;
+    }
+    portBASE_TYPE_EXIT_CRITICAL();
+
+    traceRETURN_uxQueueMessagesWaiting( uxReturn );
+
+    return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue )
+{
+    UBaseType_t uxReturn;
+    Queue_t * const pxQueue = xQueue;
+
+    traceENTER_uxQueueSpacesAvailable( xQueue );
+
+    configASSERT( pxQueue );
+
+    portBASE_TYPE_ENTER_CRITICAL();
+    {
+        uxReturn = ( UBaseType_t ) ( pxQueue->uxLength - pxQueue->uxMessagesWaiting );
+    }
+    portBASE_TYPE_EXIT_CRITICAL();
+
+    traceRETURN_uxQueueSpacesAvailable( uxReturn );
+
+    return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue )
+{
+    UBaseType_t uxReturn;
+    Queue_t * const pxQueue = xQueue;
+
+    traceENTER_uxQueueMessagesWaitingFromISR( xQueue );
+
+    configASSERT( pxQueue );
+    uxReturn = pxQueue->uxMessagesWaiting;
+
+    traceRETURN_uxQueueMessagesWaitingFromISR( uxReturn );
+
+    return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vQueueDelete( QueueHandle_t xQueue )
+{
+    Queue_t * const pxQueue = xQueue;
 
     traceENTER_vQueueDelete( xQueue );
 
@@ -2280,7 +3270,7 @@ void vQueueDelete( QueueHandle_t xQueue )
     {
         /* The queue can only have been allocated dynamically - free it
          * again. */
-        vPortFree( pxQueue );
+        vPortFreeKernelObject( pxQueue );
     }
     #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
     {
@@ -2288,7 +3278,7 @@ void vQueueDelete( QueueHandle_t xQueue )
          * check before attempting to free the memory. */
         if( pxQueue->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
         {
-            vPortFree( pxQueue );
+            vPortFreeKernelObject( pxQueue );
         }
         else
         {
@@ -2397,6 +3387,54 @@ UBaseType_t uxQueueGetQueueLength( QueueHandle_t xQueue ) /* PRIVILEGED_FUNCTION
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
+#if ( queueUSE_MUTEX_SPIN == 1 )
+
+    static BaseType_t prvSpinWhileMutexHolderRuns( const Queue_t * const pxQueue,
+                                                   UBaseType_t * const puxSpinsLeft )
+    {
+        BaseType_t xMutexAvailable = pdFALSE;
+        BaseType_t xHolderRunning = pdTRUE;
+        BaseType_t xCoreID;
+        TaskHandle_t xHolder;
+
+        while( ( *puxSpinsLeft > ( UBaseType_t ) 0U ) && ( xMutexAvailable == pdFALSE ) && ( xHolderRunning != pdFALSE ) )
+        {
+            ( *puxSpinsLeft )--;
+
+            /* uxMessagesWaiting is volatile, so it is read again each pass. */
+            if( pxQueue->uxMessagesWaiting != ( UBaseType_t ) 0U )
+            {
+                xMutexAvailable = pdTRUE;
+            }
+            else
+            {
+                /* Only the holder can give the mutex back, so spinning is only
+                 * worthwhile while it is running.  If it is preempted, blocks, or
+                 * runs on this core then block instead, which also lets priority
+                 * inheritance take effect. */
+                xHolder = pxQueue->u.xSemaphore.xMutexHolder;
+                xHolderRunning = pdFALSE;
+
+                for( xCoreID = ( BaseType_t ) 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+                {
+                    if( ( xCoreID != ( BaseType_t ) portGET_CORE_ID() ) && ( xTaskGetCurrentTaskHandleForCore( xCoreID ) == xHolder ) )
+                    {
+                        xHolderRunning = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+        }
+
+        return xMutexAvailable;
+    }
+
+#endif /* queueUSE_MUTEX_SPIN */
+/*-----------------------------------------------------------*/
+
 static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
                                       const void * pvItemToQueue,
                                       const BaseType_t xPosition )
@@ -2687,6 +3725,271 @@ static BaseType_t prvIsQueueFull( const Queue_t * pxQueue )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_QUEUE_HAND_OFF == 1 )
+
+    static BaseType_t prvHandOffToWaitingReceiver( Queue_t * const pxQueue,
+                                                   const void * pvItemToQueue,
+                                                   BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        BaseType_t xReturn = pdFALSE;
+        BaseType_t xInQueueSet = pdFALSE;
+        void * pvReceiverBuffer;
+
+        /* Queues that belong to a set must still pass their items through the
+         * storage area so the set is notified. */
+        #if ( configUSE_QUEUE_SETS == 1 )
+        {
+            if( pxQueue->pxQueueSetContainer != NULL )
+            {
+                xInQueueSet = pdTRUE;
+            }
+        }
+        #endif
+
+        /* Only an empty queue can be bypassed, otherwise the receiver would get
+         * the new item ahead of those already queued. */
+        if( ( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0U ) &&
+            ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) &&
+            ( xInQueueSet == pdFALSE ) &&
+            ( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE ) )
+        {
+            pvReceiverBuffer = pvTaskTakeQueueHandOffBuffer( &( pxQueue->xTasksWaitingToReceive ) );
+
+            if( pvReceiverBuffer != NULL )
+            {
+                ( void ) memcpy( pvReceiverBuffer, pvItemToQueue, ( size_t ) pxQueue->uxItemSize );
+
+                if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                {
+                    if( pxHigherPriorityTaskWoken != NULL )
+                    {
+                        *pxHigherPriorityTaskWoken = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                /* The receiver at the head of the list is peeking, so the item
+                 * has to go through the storage area. */
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_QUEUE_HAND_OFF */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+    static BaseType_t prvIsSendHeld( Queue_t * const pxQueue,
+                                     const BaseType_t xCopyPosition )
+    {
+        BaseType_t xReturn;
+
+        /* The scheduler is suspended, so no other task can commit or release
+         * a slot, and interrupts never change ucZeroCopyState. */
+        if( queueIS_SEND_HELD( pxQueue, xCopyPosition ) != pdFALSE )
+        {
+            pxQueue->ucZeroCopyState |= queueZERO_COPY_SEND_WAITING;
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+    static BaseType_t prvIsReceiveHeld( Queue_t * const pxQueue )
+    {
+        BaseType_t xReturn;
+
+        if( queueIS_RECEIVE_HELD( pxQueue ) != pdFALSE )
+        {
+            pxQueue->ucZeroCopyState |= queueZERO_COPY_RECEIVE_WAITING;
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+    static BaseType_t prvRemoveAllFromEventList( List_t * const pxEventList )
+    {
+        BaseType_t xYieldRequired = pdFALSE;
+
+        while( listLIST_IS_EMPTY( pxEventList ) == pdFALSE )
+        {
+            if( xTaskRemoveFromEventList( pxEventList ) != pdFALSE )
+            {
+                xYieldRequired = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xYieldRequired;
+    }
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 )
+
+    static void prvCopyMultipleToQueue( Queue_t * const pxQueue,
+                                        const void * pvItems,
+                                        const UBaseType_t uxItemCount )
+    {
+        const size_t xBytes = ( size_t ) uxItemCount * ( size_t ) pxQueue->uxItemSize;
+        size_t xFirstBytes = ( size_t ) ( pxQueue->u.xQueue.pcTail - pxQueue->pcWriteTo );
+
+        if( xFirstBytes > xBytes )
+        {
+            xFirstBytes = xBytes;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        ( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItems, xFirstBytes );
+
+        if( xBytes > xFirstBytes )
+        {
+            /* The items wrap past the end of the storage area. */
+            ( void ) memcpy( ( void * ) pxQueue->pcHead, ( const void * ) &( ( ( const uint8_t * ) pvItems )[ xFirstBytes ] ), xBytes - xFirstBytes );
+            pxQueue->pcWriteTo = pxQueue->pcHead + ( xBytes - xFirstBytes );
+        }
+        else
+        {
+            pxQueue->pcWriteTo += xFirstBytes;
+
+            if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail )
+            {
+                pxQueue->pcWriteTo = pxQueue->pcHead;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( pxQueue->uxMessagesWaiting + uxItemCount );
+    }
+
+#endif /* configUSE_QUEUE_MULTIPLE_ITEMS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 )
+
+    static void prvCopyMultipleFromQueue( Queue_t * const pxQueue,
+                                          void * pvBuffer,
+                                          const UBaseType_t uxItemCount )
+    {
+        const size_t xBytes = ( size_t ) uxItemCount * ( size_t ) pxQueue->uxItemSize;
+        int8_t * pcFirstItem = pxQueue->u.xQueue.pcReadFrom + pxQueue->uxItemSize;
+        size_t xFirstBytes;
+
+        if( pcFirstItem >= pxQueue->u.xQueue.pcTail )
+        {
+            pcFirstItem = pxQueue->pcHead;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xFirstBytes = ( size_t ) ( pxQueue->u.xQueue.pcTail - pcFirstItem );
+
+        if( xFirstBytes > xBytes )
+        {
+            xFirstBytes = xBytes;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        ( void ) memcpy( pvBuffer, ( void * ) pcFirstItem, xFirstBytes );
+
+        /* pcReadFrom is left pointing at the last item read, as it is by
+         * prvCopyDataFromQueue(). */
+        if( xBytes > xFirstBytes )
+        {
+            /* The items wrap past the end of the storage area. */
+            ( void ) memcpy( ( void * ) &( ( ( uint8_t * ) pvBuffer )[ xFirstBytes ] ), ( void * ) pxQueue->pcHead, xBytes - xFirstBytes );
+            pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead + ( ( xBytes - xFirstBytes ) - ( size_t ) pxQueue->uxItemSize );
+        }
+        else
+        {
+            pxQueue->u.xQueue.pcReadFrom = pcFirstItem + ( xFirstBytes - ( size_t ) pxQueue->uxItemSize );
+        }
+
+        pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( pxQueue->uxMessagesWaiting - uxItemCount );
+    }
+
+#endif /* configUSE_QUEUE_MULTIPLE_ITEMS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 )
+
+    static BaseType_t prvRemoveMultipleFromEventList( List_t * const pxEventList,
+                                                      UBaseType_t uxMaxTasks )
+    {
+        BaseType_t xYieldRequired = pdFALSE;
+
+        while( ( uxMaxTasks > ( UBaseType_t ) 0 ) && ( listLIST_IS_EMPTY( pxEventList ) == pdFALSE ) )
+        {
+            if( xTaskRemoveFromEventList( pxEventList ) != pdFALSE )
+            {
+                xYieldRequired = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            uxMaxTasks--;
+        }
+
+        return xYieldRequired;
+    }
+
+#endif /* configUSE_QUEUE_MULTIPLE_ITEMS */
+/*-----------------------------------------------------------*/
+
 BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 {
     BaseType_t xReturn;
@@ -0,0 +1,377 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "spsc_ring.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include SPSC ring functionality. This #if is closed at the very bottom of
+ * this file. If you want to include SPSC rings then ensure configUSE_SPSC_RINGS
+ * is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_SPSC_RINGS == 1 )
+
+/* Only needed by the ring itself, and its static inline helpers would
+ * otherwise be reported as unused when the ring is not built. */
+    #include "atomic.h"
+
+/* The head and tail are free running counts of the items pushed and popped.
+ * Their difference is the number of items in the ring, and the slot an index
+ * refers to is the index masked by ulIndexMask, which is why the length must
+ * be a power of two. */
+    typedef struct SpscRingDef_t
+    {
+        uint8_t * pucStorage;             /**< Start of the storage area. */
+        size_t xItemSize;                 /**< Size of each item in bytes. */
+        uint32_t ulIndexMask;             /**< Ring length minus one. */
+        volatile uint32_t ulHead;         /**< Items pushed.  Only written by the producer. */
+        volatile uint32_t ulTail;         /**< Items popped.  Only written by the consumer. */
+        TaskHandle_t xTaskToNotify;       /**< Consumer notified when the ring becomes non-empty, or NULL. */
+        UBaseType_t uxIndexToNotify;
+    } SpscRing_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Copies pvItem into the ring if it is not full.  *pxNotify is set to pdTRUE
+ * if the ring was empty when the item was published, meaning the consumer may
+ * be blocked waiting for it.
+ */
+    static BaseType_t prvPush( SpscRing_t * const pxRing,
+                               const void * pvItem,
+                               BaseType_t * const pxNotify ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    SpscRingHandle_t xSpscRingCreateStatic( size_t xItemSize,
+                                            UBaseType_t uxLength,
+                                            uint8_t * pucRingStorageBuffer,
+                                            StaticSpscRing_t * pxStaticRing )
+    {
+        SpscRing_t * pxRing = NULL;
+
+        traceENTER_xSpscRingCreateStatic( xItemSize, uxLength, pucRingStorageBuffer, pxStaticRing );
+
+        configASSERT( pucRingStorageBuffer );
+        configASSERT( pxStaticRing );
+        configASSERT( xItemSize > 0U );
+
+        /* The length must be a non-zero power of two, and small enough that the
+         * count of items can never be confused with a wrapped index. */
+        configASSERT( uxLength > 0U );
+        configASSERT( ( uxLength & ( uxLength - 1U ) ) == 0U );
+        configASSERT( ( uint32_t ) uxLength <= 0x80000000UL );
+
+        #if ( configASSERT_DEFINED == 1 )
+        {
+            /* Sanity check that the size of the structure used to declare a
+             * variable of type StaticSpscRing_t equals the size of the real
+             * ring structure. */
+            volatile size_t xSize = sizeof( StaticSpscRing_t );
+            configASSERT( xSize == sizeof( SpscRing_t ) );
+        }
+        #endif /* configASSERT_DEFINED */
+
+        if( ( pucRingStorageBuffer != NULL ) && ( pxStaticRing != NULL ) )
+        {
+            /* MISRA Ref 11.3.1 [Misaligned access] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+            /* coverity[misra_c_2012_rule_11_3_violation] */
+            pxRing = ( SpscRing_t * ) pxStaticRing;
+            pxRing->pucStorage = pucRingStorageBuffer;
+            pxRing->xItemSize = xItemSize;
+            pxRing->ulIndexMask = ( uint32_t ) uxLength - 1UL;
+            pxRing->ulHead = 0UL;
+            pxRing->ulTail = 0UL;
+            pxRing->xTaskToNotify = NULL;
+            pxRing->uxIndexToNotify = ( UBaseType_t ) tskDEFAULT_INDEX_TO_NOTIFY;
+        }
+
+        traceRETURN_xSpscRingCreateStatic( pxRing );
+
+        return pxRing;
+    }
+/*-----------------------------------------------------------*/
+
+    void vSpscRingSetConsumerTask( SpscRingHandle_t xRing,
+                                   TaskHandle_t xTaskToNotify,
+                                   UBaseType_t uxIndexToNotify )
+    {
+        SpscRing_t * const pxRing = xRing;
+
+        traceENTER_vSpscRingSetConsumerTask( xRing, xTaskToNotify, uxIndexToNotify );
+
+        configASSERT( pxRing );
+        configASSERT( uxIndexToNotify < ( UBaseType_t ) configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
+        pxRing->uxIndexToNotify = uxIndexToNotify;
+        pxRing->xTaskToNotify = xTaskToNotify;
+
+        /* Make the registration visible to a producer on the other core before
+         * anything the caller does next. */
+        portDATA_MEMORY_BARRIER();
+
+        traceRETURN_vSpscRingSetConsumerTask();
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvPush( SpscRing_t * const pxRing,
+                               const void * pvItem,
+                               BaseType_t * const pxNotify )
+    {
+        BaseType_t xReturn;
+        uint32_t ulHead, ulTail;
+
+        /* Only the producer writes the head, so it can be read directly. */
+        ulHead = pxRing->ulHead;
+        ulTail = Atomic_Load_u32( &( pxRing->ulTail ) );
+
+        if( ( ulHead - ulTail ) <= pxRing->ulIndexMask )
+        {
+            ( void ) memcpy( &( pxRing->pucStorage[ ( size_t ) ( ulHead & pxRing->ulIndexMask ) * pxRing->xItemSize ] ), pvItem, pxRing->xItemSize );
+
+            /* Publish the item.  The store is ordered after the copy, and before
+             * the tail is read again below. */
+            Atomic_Store_u32( &( pxRing->ulHead ), ulHead + 1UL );
+
+            /* If the consumer had already popped every earlier item it may be
+             * blocked, or about to block, waiting for this one.  The consumer
+             * publishes its tail before it reads the head, so either it sees
+             * the new head or this read sees its tail - a wake up can never be
+             * missed.  Otherwise it will find the item while draining the
+             * ring and does not need to be notified. */
+            if( Atomic_Load_u32( &( pxRing->ulTail ) ) == ulHead )
+            {
+                *pxNotify = pdTRUE;
+            }
+            else
+            {
+                *pxNotify = pdFALSE;
+            }
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            *pxNotify = pdFALSE;
+            xReturn = pdFAIL;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xSpscRingPush( SpscRingHandle_t xRing,
+                              const void * pvItem )
+    {
+        SpscRing_t * const pxRing = xRing;
+        BaseType_t xReturn, xNotify;
+        TaskHandle_t xTaskToNotify;
+
+        traceENTER_xSpscRingPush( xRing, pvItem );
+
+        configASSERT( pxRing );
+        configASSERT( pvItem );
+
+        xReturn = prvPush( pxRing, pvItem, &xNotify );
+
+        if( xNotify != pdFALSE )
+        {
+            xTaskToNotify = pxRing->xTaskToNotify;
+
+            if( xTaskToNotify != NULL )
+            {
+                ( void ) xTaskNotifyGiveIndexed( xTaskToNotify, pxRing->uxIndexToNotify );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xSpscRingPush( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xSpscRingPushFromISR( SpscRingHandle_t xRing,
+                                     const void * pvItem,
+                                     BaseType_t * pxHigherPriorityTaskWoken )
+    {
+        SpscRing_t * const pxRing = xRing;
+        BaseType_t xReturn, xNotify;
+        TaskHandle_t xTaskToNotify;
+
+        traceENTER_xSpscRingPushFromISR( xRing, pvItem, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxRing );
+        configASSERT( pvItem );
+
+        xReturn = prvPush( pxRing, pvItem, &xNotify );
+
+        if( xNotify != pdFALSE )
+        {
+            xTaskToNotify = pxRing->xTaskToNotify;
+
+            if( xTaskToNotify != NULL )
+            {
+                vTaskNotifyGiveIndexedFromISR( xTaskToNotify, pxRing->uxIndexToNotify, pxHigherPriorityTaskWoken );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xSpscRingPushFromISR( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xSpscRingPop( SpscRingHandle_t xRing,
+                             void * pvBuffer )
+    {
+        SpscRing_t * const pxRing = xRing;
+        BaseType_t xReturn;
+        uint32_t ulHead, ulTail;
+
+        traceENTER_xSpscRingPop( xRing, pvBuffer );
+
+        configASSERT( pxRing );
+        configASSERT( pvBuffer );
+
+        /* Only the consumer writes the tail, so it can be read directly. */
+        ulTail = pxRing->ulTail;
+        ulHead = Atomic_Load_u32( &( pxRing->ulHead ) );
+
+        if( ulHead != ulTail )
+        {
+            ( void ) memcpy( pvBuffer, &( pxRing->pucStorage[ ( size_t ) ( ulTail & pxRing->ulIndexMask ) * pxRing->xItemSize ] ), pxRing->xItemSize );
+
+            /* Hand the slot back to the producer only once it has been copied
+             * out. */
+            Atomic_Store_u32( &( pxRing->ulTail ), ulTail + 1UL );
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = pdFAIL;
+        }
+
+        traceRETURN_xSpscRingPop( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xSpscRingReceive( SpscRingHandle_t xRing,
+                                 void * pvBuffer,
+                                 TickType_t xTicksToWait )
+    {
+        SpscRing_t * const pxRing = xRing;
+        BaseType_t xReturn;
+        TimeOut_t xTimeOut;
+
+        traceENTER_xSpscRingReceive( xRing, pvBuffer, xTicksToWait );
+
+        configASSERT( pxRing );
+        configASSERT( ( xTicksToWait == ( TickType_t ) 0 ) || ( pxRing->xTaskToNotify == xTaskGetCurrentTaskHandle() ) );
+
+        xReturn = xSpscRingPop( xRing, pvBuffer );
+
+        if( ( xReturn == pdFAIL ) && ( xTicksToWait != ( TickType_t ) 0 ) )
+        {
+            vTaskSetTimeOutState( &xTimeOut );
+
+            do
+            {
+                /* A notification given after the ring was last seen empty is
+                 * still pending, so this only blocks if no item has been
+                 * published since.  A notification left over from an item that
+                 * was already popped just causes one extra pass. */
+                ( void ) ulTaskNotifyTakeIndexed( pxRing->uxIndexToNotify, pdTRUE, xTicksToWait );
+
+                xReturn = xSpscRingPop( xRing, pvBuffer );
+            } while( ( xReturn == pdFAIL ) && ( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xSpscRingReceive( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxSpscRingItemsWaiting( SpscRingHandle_t xRing )
+    {
+        SpscRing_t * const pxRing = xRing;
+        UBaseType_t uxReturn;
+
+        traceENTER_uxSpscRingItemsWaiting( xRing );
+
+        configASSERT( pxRing );
+
+        uxReturn = ( UBaseType_t ) ( Atomic_Load_u32( &( pxRing->ulHead ) ) - Atomic_Load_u32( &( pxRing->ulTail ) ) );
+
+        traceRETURN_uxSpscRingItemsWaiting( uxReturn );
+
+        return uxReturn;
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include SPSC ring functionality. If you want to include SPSC rings then
+ * ensure configUSE_SPSC_RINGS is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_SPSC_RINGS == 1 */
@@ -326,6 +326,31 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
                                           StreamBufferCallbackFunction_t pxSendCompletedCallback,
                                           StreamBufferCallbackFunction_t pxReceiveCompletedCallback ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+/*
+ * Describes xCount bytes of the buffer, starting at index xIndex, as up to two
+ * contiguous regions, the second of which is only used if the bytes wrap back
+ * to the start of the buffer.  Returns xCount.
+ */
+    static size_t prvGetWindow( const StreamBuffer_t * const pxStreamBuffer,
+                                size_t xIndex,
+                                size_t xCount,
+                                StreamBufferWindow_t * const pxWindow ) PRIVILEGED_FUNCTION;
+
+/*
+ * Make xBytesWritten bytes placed in a write window visible to the reader, or
+ * remove xBytesRead bytes seen through a read window, by moving the head or
+ * the tail of the buffer.  For message buffers the length of the message is
+ * written, or skipped, at the same time.  Both return the number of bytes
+ * committed.
+ */
+    static size_t prvCommitWrite( StreamBuffer_t * const pxStreamBuffer,
+                                  size_t xBytesWritten ) PRIVILEGED_FUNCTION;
+    static size_t prvCommitRead( StreamBuffer_t * const pxStreamBuffer,
+                                 size_t xBytesRead ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+
 /*-----------------------------------------------------------*/
     #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
     StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes,
@@ -1273,6 +1298,399 @@ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+    size_t xStreamBufferGetWriteWindow( StreamBufferHandle_t xStreamBuffer,
+                                        StreamBufferWindow_t * const pxWindow,
+                                        size_t xMinimumBytes,
+                                        TickType_t xTicksToWait )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xSpace, xReturn, xHead, xBytesToStoreMessageLength;
+        size_t xRequiredSpace;
+        TimeOut_t xTimeOut;
+
+        traceENTER_xStreamBufferGetWriteWindow( xStreamBuffer, pxWindow, xMinimumBytes, xTicksToWait );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( pxWindow );
+
+        /* A message buffer needs room for the length of the message ahead of
+         * the message itself. */
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+        {
+            xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+        }
+        else
+        {
+            xBytesToStoreMessageLength = 0;
+        }
+
+        /* Always wait for room for at least one byte of data. */
+        if( xMinimumBytes == ( size_t ) 0 )
+        {
+            xMinimumBytes = ( size_t ) 1;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xRequiredSpace = xMinimumBytes + xBytesToStoreMessageLength;
+
+        /* As in xStreamBufferSend(), a stream buffer waits for no more than it
+         * can ever report as free, while a message buffer that could never
+         * hold a message of the requested size does not wait at all. */
+        if( xRequiredSpace > ( pxStreamBuffer->xLength - ( size_t ) 1 ) )
+        {
+            if( xBytesToStoreMessageLength != ( size_t ) 0 )
+            {
+                xTicksToWait = ( TickType_t ) 0;
+            }
+            else
+            {
+                xRequiredSpace = pxStreamBuffer->xLength - ( size_t ) 1;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+
+        if( ( xSpace < xRequiredSpace ) && ( xTicksToWait != ( TickType_t ) 0 ) )
+        {
+            vTaskSetTimeOutState( &xTimeOut );
+
+            do
+            {
+                /* Wait until the required number of bytes are free, as
+                 * xStreamBufferSend() does. */
+                taskENTER_CRITICAL();
+                {
+                    xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+
+                    if( xSpace < xRequiredSpace )
+                    {
+                        /* Clear notification state as going to wait for space. */
+                        ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+
+                        /* Should only be one writer. */
+                        configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
+                        pxStreamBuffer->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
+                    }
+                    else
+                    {
+                        taskEXIT_CRITICAL();
+                        break;
+                    }
+                }
+                taskEXIT_CRITICAL();
+
+                traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer );
+                ( void ) xTaskNotifyWaitIndexed( pxStreamBuffer->uxNotificationIndex, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+                pxStreamBuffer->xTaskWaitingToSend = NULL;
+            } while( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE );
+
+            xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( xSpace > xBytesToStoreMessageLength )
+        {
+            /* Only the writer moves the head, so the window cannot change under
+             * the caller, it can only grow as the reader frees space. */
+            xHead = pxStreamBuffer->xHead + xBytesToStoreMessageLength;
+
+            if( xHead >= pxStreamBuffer->xLength )
+            {
+                xHead -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xReturn = prvGetWindow( pxStreamBuffer, xHead, xSpace - xBytesToStoreMessageLength, pxWindow );
+        }
+        else
+        {
+            xReturn = prvGetWindow( pxStreamBuffer, pxStreamBuffer->xHead, 0, pxWindow );
+        }
+
+        traceRETURN_xStreamBufferGetWriteWindow( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+    size_t xStreamBufferCommitWrite( StreamBufferHandle_t xStreamBuffer,
+                                     size_t xBytesWritten )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn;
+
+        traceENTER_xStreamBufferCommitWrite( xStreamBuffer, xBytesWritten );
+
+        configASSERT( pxStreamBuffer );
+
+        xReturn = prvCommitWrite( pxStreamBuffer, xBytesWritten );
+
+        if( xReturn > ( size_t ) 0 )
+        {
+            traceSTREAM_BUFFER_SEND( xStreamBuffer, xReturn );
+
+            /* Was a task waiting for the data? */
+            if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+            {
+                prvSEND_COMPLETED( pxStreamBuffer );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xStreamBufferCommitWrite( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+    size_t xStreamBufferCommitWriteFromISR( StreamBufferHandle_t xStreamBuffer,
+                                            size_t xBytesWritten,
+                                            BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn;
+
+        traceENTER_xStreamBufferCommitWriteFromISR( xStreamBuffer, xBytesWritten, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxStreamBuffer );
+
+        xReturn = prvCommitWrite( pxStreamBuffer, xBytesWritten );
+
+        if( xReturn > ( size_t ) 0 )
+        {
+            /* Was a task waiting for the data? */
+            if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+            {
+                /* MISRA Ref 4.7.1 [Return value shall be checked] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+                /* coverity[misra_c_2012_directive_4_7_violation] */
+                prvSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xReturn );
+        traceRETURN_xStreamBufferCommitWriteFromISR( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+    size_t xStreamBufferGetReadWindow( StreamBufferHandle_t xStreamBuffer,
+                                       StreamBufferWindow_t * const pxWindow,
+                                       TickType_t xTicksToWait )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn, xBytesAvailable, xBytesToStoreMessageLength, xTail;
+        configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
+
+        traceENTER_xStreamBufferGetReadWindow( xStreamBuffer, pxWindow, xTicksToWait );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( pxWindow );
+
+        /* As in xStreamBufferReceive(), the number of bytes that must be
+         * exceeded before there is anything to read. */
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+        {
+            xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+        }
+        else if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_BATCHING_BUFFER ) != ( uint8_t ) 0 )
+        {
+            xBytesToStoreMessageLength = pxStreamBuffer->xTriggerLevelBytes;
+        }
+        else
+        {
+            xBytesToStoreMessageLength = 0;
+        }
+
+        if( xTicksToWait != ( TickType_t ) 0 )
+        {
+            /* Checking if there is data and clearing the notification state
+             * must be performed atomically. */
+            taskENTER_CRITICAL();
+            {
+                xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+                if( xBytesAvailable <= xBytesToStoreMessageLength )
+                {
+                    /* Clear notification state as going to wait for data. */
+                    ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+
+                    /* Should only be one reader. */
+                    configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+                    pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( xBytesAvailable <= xBytesToStoreMessageLength )
+            {
+                /* Wait for data to be available. */
+                traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer );
+                ( void ) xTaskNotifyWaitIndexed( pxStreamBuffer->uxNotificationIndex, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+                pxStreamBuffer->xTaskWaitingToReceive = NULL;
+
+                /* Recheck the data available after blocking. */
+                xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+        }
+
+        xTail = pxStreamBuffer->xTail;
+
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+        {
+            if( xBytesAvailable > sbBYTES_TO_STORE_MESSAGE_LENGTH )
+            {
+                /* The window covers exactly the next message. */
+                xTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempNextMessageLength, sbBYTES_TO_STORE_MESSAGE_LENGTH, xTail );
+                xBytesAvailable = ( size_t ) xTempNextMessageLength;
+            }
+            else
+            {
+                xBytesAvailable = 0;
+            }
+        }
+        else
+        {
+            /* A batching buffer is read in the same way as a stream buffer
+             * once the wait is over. */
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xReturn = prvGetWindow( pxStreamBuffer, xTail, xBytesAvailable, pxWindow );
+
+        traceRETURN_xStreamBufferGetReadWindow( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+    size_t xStreamBufferCommitRead( StreamBufferHandle_t xStreamBuffer,
+                                    size_t xBytesRead )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn;
+
+        traceENTER_xStreamBufferCommitRead( xStreamBuffer, xBytesRead );
+
+        configASSERT( pxStreamBuffer );
+
+        xReturn = prvCommitRead( pxStreamBuffer, xBytesRead );
+
+        /* Was a task waiting for space in the buffer? */
+        if( xReturn != ( size_t ) 0 )
+        {
+            traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReturn );
+            prvRECEIVE_COMPLETED( pxStreamBuffer );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xStreamBufferCommitRead( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+    size_t xStreamBufferCommitReadFromISR( StreamBufferHandle_t xStreamBuffer,
+                                           size_t xBytesRead,
+                                           BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn;
+
+        traceENTER_xStreamBufferCommitReadFromISR( xStreamBuffer, xBytesRead, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxStreamBuffer );
+
+        xReturn = prvCommitRead( pxStreamBuffer, xBytesRead );
+
+        /* Was a task waiting for space in the buffer? */
+        if( xReturn != ( size_t ) 0 )
+        {
+            /* MISRA Ref 4.7.1 [Return value shall be checked] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+            /* coverity[misra_c_2012_directive_4_7_violation] */
+            prvRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReturn );
+        traceRETURN_xStreamBufferCommitReadFromISR( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
 static size_t prvReadMessageFromBuffer( StreamBuffer_t * pxStreamBuffer,
                                         void * pvRxData,
                                         size_t xBufferLengthBytes,
@@ -1584,6 +2002,160 @@ static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+    static size_t prvGetWindow( const StreamBuffer_t * const pxStreamBuffer,
+                                size_t xIndex,
+                                size_t xCount,
+                                StreamBufferWindow_t * const pxWindow )
+    {
+        size_t xFirstLength;
+
+        /* Calculate how many of the bytes come before the end of the buffer,
+         * as prvWriteBytesToBuffer() and prvReadBytesFromBuffer() do. */
+        xFirstLength = configMIN( pxStreamBuffer->xLength - xIndex, xCount );
+
+        configASSERT( ( xIndex + xFirstLength ) <= pxStreamBuffer->xLength );
+        pxWindow->pucFirst = &( pxStreamBuffer->pucBuffer[ xIndex ] );
+        pxWindow->xFirstLength = xFirstLength;
+
+        if( xCount > xFirstLength )
+        {
+            pxWindow->pucSecond = pxStreamBuffer->pucBuffer;
+            pxWindow->xSecondLength = xCount - xFirstLength;
+        }
+        else
+        {
+            pxWindow->pucSecond = NULL;
+            pxWindow->xSecondLength = 0;
+        }
+
+        return xCount;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+    static size_t prvCommitWrite( StreamBuffer_t * const pxStreamBuffer,
+                                  size_t xBytesWritten )
+    {
+        size_t xNextHead = pxStreamBuffer->xHead;
+        size_t xRequiredSpace = xBytesWritten;
+        configMESSAGE_BUFFER_LENGTH_TYPE xMessageLength;
+
+        if( xBytesWritten != ( size_t ) 0 )
+        {
+            if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+            {
+                xRequiredSpace += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+
+                /* Ensure the data length given fits within
+                 * configMESSAGE_BUFFER_LENGTH_TYPE. */
+                xMessageLength = ( configMESSAGE_BUFFER_LENGTH_TYPE ) xBytesWritten;
+                configASSERT( ( size_t ) xMessageLength == xBytesWritten );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* The bytes must have been written inside the last write window. */
+            configASSERT( xRequiredSpace <= xStreamBufferSpacesAvailable( pxStreamBuffer ) );
+
+            if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+            {
+                /* The message is already in place after the space left for its
+                 * length, so only the length has to be copied. */
+                xNextHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &( xMessageLength ), sbBYTES_TO_STORE_MESSAGE_LENGTH, xNextHead );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xNextHead += xBytesWritten;
+
+            if( xNextHead >= pxStreamBuffer->xLength )
+            {
+                xNextHead -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxStreamBuffer->xHead = xNextHead;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xBytesWritten;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+    static size_t prvCommitRead( StreamBuffer_t * const pxStreamBuffer,
+                                 size_t xBytesRead )
+    {
+        size_t xNextTail = pxStreamBuffer->xTail;
+        size_t xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+        configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
+
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+        {
+            if( xBytesAvailable > sbBYTES_TO_STORE_MESSAGE_LENGTH )
+            {
+                /* A message is always removed whole, however much of it was
+                 * used. */
+                xNextTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempNextMessageLength, sbBYTES_TO_STORE_MESSAGE_LENGTH, xNextTail );
+                configASSERT( xBytesRead <= ( size_t ) xTempNextMessageLength );
+                xBytesRead = ( size_t ) xTempNextMessageLength;
+            }
+            else
+            {
+                xBytesRead = 0;
+            }
+        }
+        else
+        {
+            /* The bytes must have been inside the last read window. */
+            configASSERT( xBytesRead <= xBytesAvailable );
+            xBytesRead = configMIN( xBytesRead, xBytesAvailable );
+        }
+
+        if( xBytesRead != ( size_t ) 0 )
+        {
+            xNextTail += xBytesRead;
+
+            if( xNextTail >= pxStreamBuffer->xLength )
+            {
+                xNextTail -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxStreamBuffer->xTail = xNextTail;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xBytesRead;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
 static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
                                           uint8_t * const pucBuffer,
                                           size_t xBufferSizeBytes,
@@ -449,6 +449,10 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
     #if ( configUSE_POSIX_ERRNO == 1 )
         int iTaskErrno;
     #endif
+
+    #if ( configUSE_QUEUE_HAND_OFF == 1 )
+        void * pvQueueHandOffBuffer; /**< Set while the task is blocked in xQueueReceive() so a sender can copy an item straight into the receiver's buffer. */
+    #endif
 } tskTCB;
 
 /* The old tskTCB name is maintained above then typedefed to the new TCB_t name
@@ -492,6 +496,22 @@ PRIVILEGED_DATA static List_t xPendingReadyList;                         /**< Ta
 
 #endif
 
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+/* Tasks due to wake less than configDELAYED_TASK_WHEEL_SIZE ticks from now are
+ * held in the slot indexed by the low bits of their wake time.  Every task in a
+ * slot therefore has the same wake time, so the slots need no sorting.  A set
+ * bit in ulDelayedTaskWheelOccupied marks a slot that might hold tasks - bits
+ * are cleared lazily if a task leaves a slot for any reason other than its
+ * timeout expiring. */
+    #define taskDELAYED_TASK_WHEEL_MASK     ( ( TickType_t ) configDELAYED_TASK_WHEEL_SIZE - ( TickType_t ) 1 )
+    #define taskDELAYED_TASK_WHEEL_WORDS    ( ( UBaseType_t ) configDELAYED_TASK_WHEEL_SIZE / ( UBaseType_t ) 32U )
+
+    PRIVILEGED_DATA static List_t xDelayedTaskWheel[ configDELAYED_TASK_WHEEL_SIZE ]; /**< Delayed tasks due within one revolution of the wheel. */
+    PRIVILEGED_DATA static uint32_t ulDelayedTaskWheelOccupied[ taskDELAYED_TASK_WHEEL_WORDS ];
+
+#endif
+
 /* Global POSIX errno. Its value is changed upon context switching to match
  * the errno of the currently running task. */
 #if ( configUSE_POSIX_ERRNO == 1 )
@@ -698,6 +718,31 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
  */
 static void prvResetNextTaskUnblockTime( void ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+/*
+ * File the current task in the delayed task wheel if it is due to wake in less
+ * than configDELAYED_TASK_WHEEL_SIZE ticks.  Returns pdFALSE, leaving the task
+ * to be placed in one of the sorted delayed lists, if it is not.
+ */
+    static BaseType_t prvDelayedTaskWheelInsert( TickType_t xTimeToWake,
+                                                 TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Move every task in the wheel slot for xConstTickCount to the ready list.
+ * Returns pdTRUE if one of those tasks should preempt the running task.
+ */
+    static BaseType_t prvDelayedTaskWheelUnblock( TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the earliest wake time held in the wheel, or portMAX_DELAY if the
+ * wheel is empty or the earliest wake time lies beyond the next tick count
+ * overflow.
+ */
+    static TickType_t prvDelayedTaskWheelNextWakeTime( TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+#endif
+
 #if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
 
 /*
@@ -1532,7 +1577,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             /* MISRA Ref 11.5.1 [Malloc memory assignment] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
             /* coverity[misra_c_2012_rule_11_5_violation] */
-            pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+            pxNewTCB = ( TCB_t * ) pvPortMallocKernelObject( sizeof( TCB_t ) );
 
             if( pxNewTCB != NULL )
             {
@@ -1659,7 +1704,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             /* MISRA Ref 11.5.1 [Malloc memory assignment] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
             /* coverity[misra_c_2012_rule_11_5_violation] */
-            pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+            pxNewTCB = ( TCB_t * ) pvPortMallocKernelObject( sizeof( TCB_t ) );
 
             if( pxNewTCB != NULL )
             {
@@ -1676,7 +1721,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
                 if( pxNewTCB->pxStack == NULL )
                 {
                     /* Could not allocate the stack.  Delete the allocated TCB. */
-                    vPortFree( pxNewTCB );
+                    vPortFreeKernelObject( pxNewTCB );
                     pxNewTCB = NULL;
                 }
             }
@@ -1697,7 +1742,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
                 /* MISRA Ref 11.5.1 [Malloc memory assignment] */
                 /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
                 /* coverity[misra_c_2012_rule_11_5_violation] */
-                pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+                pxNewTCB = ( TCB_t * ) pvPortMallocKernelObject( sizeof( TCB_t ) );
 
                 if( pxNewTCB != NULL )
                 {
@@ -2550,6 +2595,15 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
                 eReturn = eBlocked;
             }
 
+            #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+                else if( ( pxStateList >= &( xDelayedTaskWheel[ 0 ] ) ) && ( pxStateList <= &( xDelayedTaskWheel[ configDELAYED_TASK_WHEEL_SIZE - 1 ] ) ) )
+                {
+                    /* The task being queried is referenced from one of the
+                     * delayed task wheel slots. */
+                    eReturn = eBlocked;
+                }
+            #endif
+
             #if ( INCLUDE_vTaskSuspend == 1 )
                 else if( pxStateList == &xSuspendedTaskList )
                 {
@@ -4350,6 +4404,17 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
                 pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
             }
 
+            #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+            {
+                UBaseType_t uxSlot;
+
+                for( uxSlot = 0; ( uxSlot < ( UBaseType_t ) configDELAYED_TASK_WHEEL_SIZE ) && ( pxTCB == NULL ); uxSlot++ )
+                {
+                    pxTCB = prvSearchForNameWithinSingleList( &( xDelayedTaskWheel[ uxSlot ] ), pcNameToQuery );
+                }
+            }
+            #endif
+
             #if ( INCLUDE_vTaskSuspend == 1 )
             {
                 if( pxTCB == NULL )
@@ -4463,6 +4528,15 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
                 uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked ) );
                 uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked ) );
 
+                #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+                {
+                    for( uxQueue = 0; uxQueue < ( UBaseType_t ) configDELAYED_TASK_WHEEL_SIZE; uxQueue++ )
+                    {
+                        uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( xDelayedTaskWheel[ uxQueue ] ), eBlocked ) );
+                    }
+                }
+                #endif
+
                 #if ( INCLUDE_vTaskDelete == 1 )
                 {
                     /* Fill in an TaskStatus_t structure with information on
@@ -4764,6 +4838,20 @@ BaseType_t xTaskIncrementTick( void )
          * look any further down the list. */
         if( xConstTickCount >= xNextTaskUnblockTime )
         {
+            #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+            {
+                /* Tasks in the wheel slot for this tick are all due now. */
+                if( prvDelayedTaskWheelUnblock( xConstTickCount ) != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_DELAYED_TASK_WHEEL */
+
             for( ; ; )
             {
                 if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
@@ -4853,6 +4941,24 @@ BaseType_t xTaskIncrementTick( void )
                     #endif /* #if ( configUSE_PREEMPTION == 1 ) */
                 }
             }
+
+            #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+            {
+                /* The loop above only considered the sorted delayed list, so
+                 * bring xNextTaskUnblockTime forward if a task in the wheel is
+                 * due sooner. */
+                xItemValue = prvDelayedTaskWheelNextWakeTime( xConstTickCount );
+
+                if( xItemValue < xNextTaskUnblockTime )
+                {
+                    xNextTaskUnblockTime = xItemValue;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_DELAYED_TASK_WHEEL */
         }
 
         /* Tasks of equal priority to the currently running task will share
@@ -5556,6 +5662,170 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_EVENT_GROUP_DIRECT_ISR_SET == 1 )
+
+    BaseType_t xTaskRemoveFromUnorderedEventListFromISR( ListItem_t * pxEventListItem,
+                                                         const TickType_t xItemValue )
+    {
+        TCB_t * pxUnblockedTCB;
+        BaseType_t xReturn;
+
+        traceENTER_xTaskRemoveFromUnorderedEventListFromISR( pxEventListItem, xItemValue );
+
+        /* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  The event group
+         * only calls it while no task has the event group locked, so nothing
+         * else is accessing the event list. */
+
+        /* Store the new item value in the event list. */
+        listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+
+        /* MISRA Ref 11.5.3 [Void pointer assignment] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+        /* coverity[misra_c_2012_rule_11_5_violation] */
+        pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem );
+        configASSERT( pxUnblockedTCB );
+        listREMOVE_ITEM( pxEventListItem );
+
+        /* From here on this is the same as xTaskRemoveFromEventList(). */
+        if( uxSchedulerSuspended == ( UBaseType_t ) 0U )
+        {
+            listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
+            prvAddTaskToReadyList( pxUnblockedTCB );
+
+            #if ( configUSE_TICKLESS_IDLE != 0 )
+            {
+                /* See the comment in xTaskRemoveFromEventList(). */
+                prvResetNextTaskUnblockTime();
+            }
+            #endif
+        }
+        else
+        {
+            /* The delayed and ready lists cannot be accessed, so hold this task
+             * pending until the scheduler is resumed. */
+            listINSERT_END( &( xPendingReadyList ), pxEventListItem );
+        }
+
+        #if ( configNUMBER_OF_CORES == 1 )
+        {
+            if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+            {
+                xReturn = pdTRUE;
+
+                /* Mark that a yield is pending in case the caller does not use
+                 * the "xHigherPriorityTaskWoken" parameter. */
+                xYieldPendings[ 0 ] = pdTRUE;
+            }
+            else
+            {
+                xReturn = pdFALSE;
+            }
+        }
+        #else /* #if ( configNUMBER_OF_CORES == 1 ) */
+        {
+            xReturn = pdFALSE;
+
+            #if ( configUSE_PREEMPTION == 1 )
+            {
+                prvYieldForTask( pxUnblockedTCB );
+
+                if( xYieldPendings[ portGET_CORE_ID() ] != pdFALSE )
+                {
+                    xReturn = pdTRUE;
+                }
+            }
+            #endif /* #if ( configUSE_PREEMPTION == 1 ) */
+        }
+        #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
+
+        traceRETURN_xTaskRemoveFromUnorderedEventListFromISR( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_EVENT_GROUP_DIRECT_ISR_SET */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_HAND_OFF == 1 )
+
+    void vTaskSetQueueHandOffBuffer( void * pvBuffer )
+    {
+        traceENTER_vTaskSetQueueHandOffBuffer( pvBuffer );
+
+        /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  The
+         * buffer is published before the task is placed on the event list, and
+         * senders only read it while holding the queue's critical section after
+         * finding the task on that list. */
+        configASSERT( pvBuffer != NULL );
+        pxCurrentTCB->pvQueueHandOffBuffer = pvBuffer;
+
+        traceRETURN_vTaskSetQueueHandOffBuffer();
+    }
+
+#endif /* configUSE_QUEUE_HAND_OFF */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_HAND_OFF == 1 )
+
+    void * pvTaskTakeQueueHandOffBuffer( const List_t * const pxEventList )
+    {
+        TCB_t * pxReceiverTCB;
+        void * pvBuffer;
+
+        traceENTER_pvTaskTakeQueueHandOffBuffer( pxEventList );
+
+        /* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION, and the caller
+         * must already have checked that pxEventList is not empty.  The task
+         * returned by listGET_OWNER_OF_HEAD_ENTRY() is the one the following
+         * xTaskRemoveFromEventList() call will unblock. */
+        /* MISRA Ref 11.5.3 [Void pointer assignment] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+        /* coverity[misra_c_2012_rule_11_5_violation] */
+        pxReceiverTCB = listGET_OWNER_OF_HEAD_ENTRY( pxEventList );
+        configASSERT( pxReceiverTCB );
+
+        pvBuffer = pxReceiverTCB->pvQueueHandOffBuffer;
+        pxReceiverTCB->pvQueueHandOffBuffer = NULL;
+
+        traceRETURN_pvTaskTakeQueueHandOffBuffer( pvBuffer );
+
+        return pvBuffer;
+    }
+
+#endif /* configUSE_QUEUE_HAND_OFF */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_HAND_OFF == 1 )
+
+    BaseType_t xTaskResetQueueHandOffBuffer( void )
+    {
+        TCB_t * pxTCB;
+        BaseType_t xReturn;
+
+        traceENTER_xTaskResetQueueHandOffBuffer();
+
+        /* The task is no longer on the event list, so no sender can take the
+         * buffer between the check and the clear below. */
+        pxTCB = pxCurrentTCB;
+
+        if( pxTCB->pvQueueHandOffBuffer == NULL )
+        {
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            pxTCB->pvQueueHandOffBuffer = NULL;
+            xReturn = pdFALSE;
+        }
+
+        traceRETURN_xTaskResetQueueHandOffBuffer( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_QUEUE_HAND_OFF */
+/*-----------------------------------------------------------*/
+
 void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
 {
     traceENTER_vTaskSetTimeOutState( pxTimeOut );
@@ -6075,6 +6345,20 @@ static void prvInitialiseTaskLists( void )
 
     vListInitialise( &xDelayedTaskList1 );
     vListInitialise( &xDelayedTaskList2 );
+
+    #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+    {
+        UBaseType_t uxSlot;
+
+        for( uxSlot = ( UBaseType_t ) 0U; uxSlot < ( UBaseType_t ) configDELAYED_TASK_WHEEL_SIZE; uxSlot++ )
+        {
+            vListInitialise( &( xDelayedTaskWheel[ uxSlot ] ) );
+        }
+
+        ( void ) memset( ulDelayedTaskWheelOccupied, 0x00, sizeof( ulDelayedTaskWheelOccupied ) );
+    }
+    #endif /* configUSE_DELAYED_TASK_WHEEL */
+
     vListInitialise( &xPendingReadyList );
 
     #if ( INCLUDE_vTaskDelete == 1 )
@@ -6478,7 +6762,7 @@ static void prvCheckTasksWaitingTermination( void )
             /* The task can only have been allocated dynamically - free both
              * the stack and TCB. */
             vPortFreeStack( pxTCB->pxStack );
-            vPortFree( pxTCB );
+            vPortFreeKernelObject( pxTCB );
         }
         #elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
         {
@@ -6490,13 +6774,13 @@ static void prvCheckTasksWaitingTermination( void )
                 /* Both the stack and TCB were allocated dynamically, so both
                  * must be freed. */
                 vPortFreeStack( pxTCB->pxStack );
-                vPortFree( pxTCB );
+                vPortFreeKernelObject( pxTCB );
             }
             else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
             {
                 /* Only the stack was statically allocated, so the TCB is the
                  * only memory that must be freed. */
-                vPortFree( pxTCB );
+                vPortFreeKernelObject( pxTCB );
             }
             else
             {
@@ -6530,9 +6814,204 @@ static void prvResetNextTaskUnblockTime( void )
          * from the Blocked state. */
         xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
     }
+
+    #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+    {
+        const TickType_t xWheelWakeTime = prvDelayedTaskWheelNextWakeTime( xTickCount );
+
+        if( xWheelWakeTime < xNextTaskUnblockTime )
+        {
+            xNextTaskUnblockTime = xWheelWakeTime;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* configUSE_DELAYED_TASK_WHEEL */
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+    static uint8_t prvDelayedTaskWheelLowestSetBit( uint32_t ulBitmap )
+    {
+        static const uint8_t ucDeBruijnBitPosition[ 32 ] =
+        {
+            0U,  1U,  28U, 2U,  29U, 14U, 24U, 3U, 30U, 22U, 20U, 15U, 25U, 17U, 4U,  8U,
+            31U, 27U, 13U, 23U, 21U, 19U, 16U, 7U, 26U, 12U, 18U, 6U,  11U, 5U,  10U, 9U
+        };
+
+        return ucDeBruijnBitPosition[ ( uint32_t ) ( ( ulBitmap & ( ( ~ulBitmap ) + 1U ) ) * 0x077CB531UL ) >> 27 ];
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvDelayedTaskWheelInsert( TickType_t xTimeToWake,
+                                                 TickType_t xConstTickCount )
+    {
+        const TickType_t xTicksToWait = xTimeToWake - xConstTickCount;
+        UBaseType_t uxSlot;
+        BaseType_t xReturn = pdFALSE;
+
+        /* A zero delay is left to the sorted list, as the slot for the current
+         * tick will not be looked at again until the wheel has turned once. */
+        if( ( xTicksToWait != ( TickType_t ) 0U ) && ( xTicksToWait <= taskDELAYED_TASK_WHEEL_MASK ) )
+        {
+            uxSlot = ( UBaseType_t ) ( xTimeToWake & taskDELAYED_TASK_WHEEL_MASK );
+
+            traceMOVED_TASK_TO_DELAYED_LIST();
+            listINSERT_END( &( xDelayedTaskWheel[ uxSlot ] ), &( pxCurrentTCB->xStateListItem ) );
+            ulDelayedTaskWheelOccupied[ uxSlot >> 5 ] |= ( uint32_t ) 1U << ( uxSlot & 31U );
+
+            /* A wake time that has overflowed is picked up when the delayed
+             * lists are switched. */
+            if( ( xTimeToWake > xConstTickCount ) && ( xTimeToWake < xNextTaskUnblockTime ) )
+            {
+                xNextTaskUnblockTime = xTimeToWake;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvDelayedTaskWheelUnblock( TickType_t xConstTickCount )
+    {
+        const UBaseType_t uxSlot = ( UBaseType_t ) ( xConstTickCount & taskDELAYED_TASK_WHEEL_MASK );
+        List_t * const pxSlot = &( xDelayedTaskWheel[ uxSlot ] );
+        TCB_t * pxTCB;
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+        {
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxSlot );
+
+            /* The wheel only holds wake times less than one turn ahead, so
+             * everything in this slot is due on this tick. */
+            configASSERT( listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) ) == xConstTickCount );
+
+            listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+
+            if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+            {
+                listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            prvAddTaskToReadyList( pxTCB );
+
+            #if ( configUSE_PREEMPTION == 1 )
+            {
+                #if ( configNUMBER_OF_CORES == 1 )
+                {
+                    if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #else /* #if ( configNUMBER_OF_CORES == 1 ) */
+                {
+                    prvYieldForTask( pxTCB );
+                }
+                #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
+            }
+            #endif /* #if ( configUSE_PREEMPTION == 1 ) */
+        }
+
+        ulDelayedTaskWheelOccupied[ uxSlot >> 5 ] &= ~( ( uint32_t ) 1U << ( uxSlot & 31U ) );
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    static TickType_t prvDelayedTaskWheelNextWakeTime( TickType_t xConstTickCount )
+    {
+        const UBaseType_t uxFirstSlot = ( UBaseType_t ) ( xConstTickCount & taskDELAYED_TASK_WHEEL_MASK );
+        UBaseType_t uxWord = uxFirstSlot >> 5;
+        UBaseType_t uxPass;
+        UBaseType_t uxSlot;
+        const uint32_t ulFirstMask = ~( uint32_t ) 0U << ( uxFirstSlot & 31U );
+        uint32_t ulMask = ulFirstMask;
+        uint32_t ulOccupied;
+        TickType_t xWakeTime = portMAX_DELAY;
+        BaseType_t xFound = pdFALSE;
+
+        /* Slots are visited in wake time order starting from the slot for the
+         * current tick, which is only occupied when the tick count has just
+         * overflowed to a tick that has tasks due.  The word holding the first
+         * slot is visited twice, once for the slots at or after the first slot
+         * and once, after wrapping around, for the slots before it. */
+        for( uxPass = 0; ( uxPass <= taskDELAYED_TASK_WHEEL_WORDS ) && ( xFound == pdFALSE ); uxPass++ )
+        {
+            ulOccupied = ulDelayedTaskWheelOccupied[ uxWord ] & ulMask;
+
+            while( ( ulOccupied != 0U ) && ( xFound == pdFALSE ) )
+            {
+                uxSlot = ( uxWord << 5 ) + ( UBaseType_t ) prvDelayedTaskWheelLowestSetBit( ulOccupied );
+
+                if( listLIST_IS_EMPTY( &( xDelayedTaskWheel[ uxSlot ] ) ) == pdFALSE )
+                {
+                    xWakeTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( xDelayedTaskWheel[ uxSlot ] ) );
+                    xFound = pdTRUE;
+                }
+                else
+                {
+                    /* Every task in the slot left the Blocked state early. */
+                    ulDelayedTaskWheelOccupied[ uxWord ] &= ~( ( uint32_t ) 1U << ( uxSlot & 31U ) );
+                    ulOccupied &= ulOccupied - 1U;
+                }
+            }
+
+            uxWord = ( uxWord + 1U ) & ( taskDELAYED_TASK_WHEEL_WORDS - 1U );
+
+            if( ( uxPass + 1U ) == taskDELAYED_TASK_WHEEL_WORDS )
+            {
+                ulMask = ~ulFirstMask;
+            }
+            else
+            {
+                ulMask = ~( uint32_t ) 0U;
+            }
+        }
+
+        if( xWakeTime < xConstTickCount )
+        {
+            /* The earliest wake time has overflowed, so it and everything
+             * after it in the wheel will be found again once the delayed lists
+             * are switched. */
+            xWakeTime = portMAX_DELAY;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xWakeTime;
+    }
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+/*-----------------------------------------------------------*/
+
 #if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_RECURSIVE_MUTEXES == 1 ) ) || ( configNUMBER_OF_CORES > 1 )
 
     #if ( configNUMBER_OF_CORES == 1 )
@@ -8625,6 +9104,15 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
             /* The list item will be inserted in wake time order. */
             listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
+            #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+                if( prvDelayedTaskWheelInsert( xTimeToWake, xConstTickCount ) != pdFALSE )
+                {
+                    /* The wake time is close enough for the delayed task
+                     * wheel. */
+                    mtCOVERAGE_TEST_MARKER();
+                }
+                else
+            #endif
             if( xTimeToWake < xConstTickCount )
             {
                 /* Wake time has overflowed.  Place this item in the overflow
@@ -8663,6 +9151,14 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
         /* The list item will be inserted in wake time order. */
         listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
+        #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+            if( prvDelayedTaskWheelInsert( xTimeToWake, xConstTickCount ) != pdFALSE )
+            {
+                /* The wake time is close enough for the delayed task wheel. */
+                mtCOVERAGE_TEST_MARKER();
+            }
+            else
+        #endif
         if( xTimeToWake < xConstTickCount )
         {
             traceMOVED_TASK_TO_OVERFLOW_DELAYED_LIST();
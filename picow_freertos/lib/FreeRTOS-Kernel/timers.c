@@ -140,10 +140,59 @@
  * xActiveTimerList1 and xActiveTimerList2 could be at function scope but that
  * breaks some kernel aware debuggers, and debuggers that reply on removing the
  * static qualifier. */
-    PRIVILEGED_DATA static List_t xActiveTimerList1;
-    PRIVILEGED_DATA static List_t xActiveTimerList2;
-    PRIVILEGED_DATA static List_t * pxCurrentTimerList;
-    PRIVILEGED_DATA static List_t * pxOverflowTimerList;
+    #if ( configUSE_TIMER_WHEEL == 0 )
+        PRIVILEGED_DATA static List_t xActiveTimerList1;
+        PRIVILEGED_DATA static List_t xActiveTimerList2;
+        PRIVILEGED_DATA static List_t * pxCurrentTimerList;
+        PRIVILEGED_DATA static List_t * pxOverflowTimerList;
+    #else /* if ( configUSE_TIMER_WHEEL == 0 ) */
+
+/* When configUSE_TIMER_WHEEL is 1 active timers are instead held in a
+ * hierarchical timing wheel.  Slot i of level l holds the timers that are due
+ * to be moved down to a lower level (or, at level 0, to expire) at the next
+ * tick count whose bits l * configTIMER_WHEEL_SLOT_BITS and above select slot i.
+ * Timers within a slot are not sorted, so starting and stopping a timer is a
+ * constant time list insert or remove.  ulTimerWheelOccupied holds one bit per
+ * non-empty slot so the next event can be found without scanning the slots.
+ * xTimerWheelTime is the tick count the wheel was last advanced to.  Because
+ * slots are selected by the expiry time modulo the wheel size, tick count
+ * overflows need no special handling. */
+        #define tmrWHEEL_SLOTS        ( ( UBaseType_t ) 1U << configTIMER_WHEEL_SLOT_BITS )
+        #define tmrWHEEL_SLOT_MASK    ( tmrWHEEL_SLOTS - ( UBaseType_t ) 1U )
+        #define tmrWHEEL_LEVEL_SHIFT( uxLevel )    ( ( UBaseType_t ) configTIMER_WHEEL_SLOT_BITS * ( uxLevel ) )
+
+        #if ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_16_BITS )
+            #define tmrTICK_TYPE_BITS    16
+        #elif ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_32_BITS )
+            #define tmrTICK_TYPE_BITS    32
+        #else
+            #define tmrTICK_TYPE_BITS    64
+        #endif
+
+        #if ( ( configTIMER_WHEEL_SLOT_BITS * ( configTIMER_WHEEL_LEVELS - 1 ) ) >= tmrTICK_TYPE_BITS )
+            #error configTIMER_WHEEL_LEVELS is larger than needed to cover the full range of TickType_t.
+        #endif
+
+/* If the wheel does not cover the full range of TickType_t then timers due
+ * beyond tmrWHEEL_HORIZON ticks are parked in the top level and re-filed each
+ * time that level wraps. */
+        #if ( ( configTIMER_WHEEL_SLOT_BITS * configTIMER_WHEEL_LEVELS ) < tmrTICK_TYPE_BITS )
+            #define tmrWHEEL_HORIZON    ( ( TickType_t ) 1U << ( configTIMER_WHEEL_SLOT_BITS * configTIMER_WHEEL_LEVELS ) )
+        #endif
+
+        PRIVILEGED_DATA static List_t xTimerWheel[ configTIMER_WHEEL_LEVELS * ( 1U << configTIMER_WHEEL_SLOT_BITS ) ];
+        PRIVILEGED_DATA static uint32_t ulTimerWheelOccupied[ configTIMER_WHEEL_LEVELS ];
+        PRIVILEGED_DATA static TickType_t xTimerWheelTime = ( TickType_t ) 0U;
+    #endif /* if ( configUSE_TIMER_WHEEL == 0 ) */
+
+/* Has the tick count reached xExpireTime?  With the timer wheel the comparison
+ * is made relative to xTimerWheelTime, which is never ahead of either value. */
+    #if ( configUSE_TIMER_WHEEL == 0 )
+        #define tmrEXPIRY_TIME_REACHED( xExpireTime, xTimeNow )    ( ( ( xExpireTime ) <= ( xTimeNow ) ) ? pdTRUE : pdFALSE )
+    #else
+        #define tmrEXPIRY_TIME_REACHED( xExpireTime, xTimeNow ) \
+    ( ( ( TickType_t ) ( ( xExpireTime ) - xTimerWheelTime ) <= ( TickType_t ) ( ( xTimeNow ) - xTimerWheelTime ) ) ? pdTRUE : pdFALSE )
+    #endif
 
 /* A queue that is used to send commands to the timer service task. */
     PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
@@ -195,11 +244,35 @@
     static void prvProcessExpiredTimer( const TickType_t xNextExpireTime,
                                         const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
 
+/*
+ * Remove an active timer from whichever list or wheel slot holds it.
+ */
+    static void prvRemoveTimerFromActiveList( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+    #if ( configUSE_TIMER_WHEEL == 0 )
+
 /*
  * The tick count has overflowed.  Switch the timer lists after ensuring the
  * current timer list does not still reference some timers.
  */
-    static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+        static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+
+    #else /* if ( configUSE_TIMER_WHEEL == 0 ) */
+
+/*
+ * File the timer, whose list item value holds its expiry time, in the wheel
+ * slot that matches its distance from xTimerWheelTime.
+ */
+        static void prvTimerWheelInsert( Timer_t * const pxTimer,
+                                         const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+/*
+ * Move the timers held in the higher level slots that become due at
+ * xTimerWheelTime down to the lower levels.
+ */
+        static void prvTimerWheelCascade( void ) PRIVILEGED_FUNCTION;
+
+    #endif /* if ( configUSE_TIMER_WHEEL == 0 ) */
 
 /*
  * Obtain the current tick count, setting *pxTimerListsWereSwitched to pdTRUE
@@ -714,30 +787,74 @@
     static void prvProcessExpiredTimer( const TickType_t xNextExpireTime,
                                         const TickType_t xTimeNow )
     {
-        /* MISRA Ref 11.5.3 [Void pointer assignment] */
-        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-        /* coverity[misra_c_2012_rule_11_5_violation] */
-        Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList );
+        Timer_t * pxTimer;
 
-        /* Remove the timer from the list of active timers.  A check has already
-         * been performed to ensure the list is not empty. */
+        #if ( configUSE_TIMER_WHEEL == 0 )
+        {
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList );
+        }
+        #else /* if ( configUSE_TIMER_WHEEL == 0 ) */
+        {
+            const List_t * const pxSlot = &( xTimerWheel[ ( UBaseType_t ) xNextExpireTime & tmrWHEEL_SLOT_MASK ] );
 
-        ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+            /* The first time the wheel reaches xNextExpireTime, move the timers
+             * that become due at this tick down from the higher levels. */
+            if( xTimerWheelTime != xNextExpireTime )
+            {
+                xTimerWheelTime = xNextExpireTime;
+                prvTimerWheelCascade();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* Every timer in the level 0 slot for this tick expires now.  The
+             * slot can also be empty if xNextExpireTime was only the point at
+             * which a higher level slot had to be cascaded. */
+            if( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+            {
+                /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot );
+                configASSERT( listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) ) == xNextExpireTime );
+            }
+            else
+            {
+                pxTimer = NULL;
+            }
+        }
+        #endif /* if ( configUSE_TIMER_WHEEL == 0 ) */
 
-        /* If the timer is an auto-reload timer then calculate the next
-         * expiry time and re-insert the timer in the list of active timers. */
-        if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0U )
+        if( pxTimer != NULL )
         {
-            prvReloadTimer( pxTimer, xNextExpireTime, xTimeNow );
+            /* Remove the timer from the list of active timers.  A check has
+             * already been performed to ensure the list is not empty. */
+            prvRemoveTimerFromActiveList( pxTimer );
+
+            /* If the timer is an auto-reload timer then calculate the next
+             * expiry time and re-insert the timer in the list of active timers. */
+            if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0U )
+            {
+                prvReloadTimer( pxTimer, xNextExpireTime, xTimeNow );
+            }
+            else
+            {
+                pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
+            }
+
+            /* Call the timer callback. */
+            traceTIMER_EXPIRED( pxTimer );
+            pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
         }
         else
         {
-            pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
+            mtCOVERAGE_TEST_MARKER();
         }
-
-        /* Call the timer callback. */
-        traceTIMER_EXPIRED( pxTimer );
-        pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
     }
 /*-----------------------------------------------------------*/
 
@@ -793,7 +910,7 @@
             if( xTimerListsWereSwitched == pdFALSE )
             {
                 /* The tick count has not overflowed, has the timer expired? */
-                if( ( xListWasEmpty == pdFALSE ) && ( xNextExpireTime <= xTimeNow ) )
+                if( ( xListWasEmpty == pdFALSE ) && ( tmrEXPIRY_TIME_REACHED( xNextExpireTime, xTimeNow ) != pdFALSE ) )
                 {
                     ( void ) xTaskResumeAll();
                     prvProcessExpiredTimer( xNextExpireTime, xTimeNow );
@@ -806,12 +923,24 @@
                      * received - whichever comes first.  The following line cannot
                      * be reached unless xNextExpireTime > xTimeNow, except in the
                      * case when the current timer list is empty. */
-                    if( xListWasEmpty != pdFALSE )
+                    #if ( configUSE_TIMER_WHEEL == 0 )
                     {
-                        /* The current timer list is empty - is the overflow list
-                         * also empty? */
-                        xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
+                        if( xListWasEmpty != pdFALSE )
+                        {
+                            /* The current timer list is empty - is the overflow list
+                             * also empty? */
+                            xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
+                        }
                     }
+                    #else /* if ( configUSE_TIMER_WHEEL == 0 ) */
+                    {
+                        /* Nothing in the wheel is due before xNextExpireTime, so
+                         * the wheel can be brought up to date.  This keeps the
+                         * distance between xTimerWheelTime and any new expiry
+                         * time within the range of TickType_t. */
+                        xTimerWheelTime = xTimeNow;
+                    }
+                    #endif /* if ( configUSE_TIMER_WHEEL == 0 ) */
 
                     vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
 
@@ -837,51 +966,148 @@
     }
 /*-----------------------------------------------------------*/
 
-    static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
-    {
-        TickType_t xNextExpireTime;
+    #if ( configUSE_TIMER_WHEEL == 0 )
+
+        static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
+        {
+            TickType_t xNextExpireTime;
+
+            /* Timers are listed in expiry time order, with the head of the list
+             * referencing the task that will expire first.  Obtain the time at which
+             * the timer with the nearest expiry time will expire.  If there are no
+             * active timers then just set the next expire time to 0.  That will cause
+             * this task to unblock when the tick count overflows, at which point the
+             * timer lists will be switched and the next expiry time can be
+             * re-assessed.  */
+            *pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
+
+            if( *pxListWasEmpty == pdFALSE )
+            {
+                xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+            }
+            else
+            {
+                /* Ensure the task unblocks when the tick count rolls over. */
+                xNextExpireTime = ( TickType_t ) 0U;
+            }
 
-        /* Timers are listed in expiry time order, with the head of the list
-         * referencing the task that will expire first.  Obtain the time at which
-         * the timer with the nearest expiry time will expire.  If there are no
-         * active timers then just set the next expire time to 0.  That will cause
-         * this task to unblock when the tick count overflows, at which point the
-         * timer lists will be switched and the next expiry time can be
-         * re-assessed.  */
-        *pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
+            return xNextExpireTime;
+        }
 
-        if( *pxListWasEmpty == pdFALSE )
+    #else /* if ( configUSE_TIMER_WHEEL == 0 ) */
+
+/* Index of the lowest set bit of a non-zero value.  The multiply by a de Bruijn
+ * sequence keeps this constant time on cores without a count leading or
+ * trailing zeros instruction. */
+        static uint8_t prvTimerWheelLowestSetBit( uint32_t ulBitmap )
         {
-            xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+            static const uint8_t ucDeBruijnBitPosition[ 32 ] =
+            {
+                0U,  1U,  28U, 2U,  29U, 14U, 24U, 3U, 30U, 22U, 20U, 15U, 25U, 17U, 4U,  8U,
+                31U, 27U, 13U, 23U, 21U, 19U, 16U, 7U, 26U, 12U, 18U, 6U,  11U, 5U,  10U, 9U
+            };
+
+            return ucDeBruijnBitPosition[ ( uint32_t ) ( ( ulBitmap & ( ( ~ulBitmap ) + 1U ) ) * 0x077CB531UL ) >> 27 ];
         }
-        else
+/*-----------------------------------------------------------*/
+
+        static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
         {
-            /* Ensure the task unblocks when the tick count rolls over. */
-            xNextExpireTime = ( TickType_t ) 0U;
+            TickType_t xNextExpireTime = ( TickType_t ) 0U;
+            TickType_t xNearest = portMAX_DELAY;
+            TickType_t xCandidate;
+            UBaseType_t uxLevel;
+            UBaseType_t uxCurrentSlot;
+            UBaseType_t uxOffset;
+            uint32_t ulOccupied;
+
+            *pxListWasEmpty = pdTRUE;
+
+            /* For each level find the first occupied slot at or after the slot
+             * xTimerWheelTime falls in, and from that the tick at which the slot
+             * must be processed.  The nearest of those is the next time the
+             * timer task has work to do. */
+            for( uxLevel = 0; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+            {
+                ulOccupied = ulTimerWheelOccupied[ uxLevel ];
+
+                if( ulOccupied != 0U )
+                {
+                    uxCurrentSlot = ( UBaseType_t ) ( xTimerWheelTime >> tmrWHEEL_LEVEL_SHIFT( uxLevel ) ) & tmrWHEEL_SLOT_MASK;
+
+                    if( uxCurrentSlot != 0U )
+                    {
+                        /* Rotate so bit 0 is the current slot. */
+                        ulOccupied = ( ulOccupied >> uxCurrentSlot ) | ( ulOccupied << ( tmrWHEEL_SLOTS - uxCurrentSlot ) );
+                        ulOccupied &= ( ( uint32_t ) 0xffffffffUL ) >> ( 32U - tmrWHEEL_SLOTS );
+                    }
+
+                    if( uxLevel == 0U )
+                    {
+                        uxOffset = ( UBaseType_t ) prvTimerWheelLowestSetBit( ulOccupied );
+                        xCandidate = xTimerWheelTime + ( TickType_t ) uxOffset;
+                    }
+                    else
+                    {
+                        /* A higher level slot is due at the start of the span
+                         * it covers.  The current slot's span has already
+                         * started, so anything in it belongs to the next turn
+                         * of the level and is due after every other slot. */
+                        if( ( ulOccupied & ~( uint32_t ) 1U ) != 0U )
+                        {
+                            uxOffset = ( UBaseType_t ) prvTimerWheelLowestSetBit( ulOccupied & ~( uint32_t ) 1U );
+                        }
+                        else
+                        {
+                            uxOffset = tmrWHEEL_SLOTS;
+                        }
+
+                        xCandidate = ( TickType_t ) ( ( ( xTimerWheelTime >> tmrWHEEL_LEVEL_SHIFT( uxLevel ) ) + ( TickType_t ) uxOffset ) << tmrWHEEL_LEVEL_SHIFT( uxLevel ) );
+                    }
+
+                    if( ( *pxListWasEmpty != pdFALSE ) || ( ( TickType_t ) ( xCandidate - xTimerWheelTime ) < xNearest ) )
+                    {
+                        xNearest = ( TickType_t ) ( xCandidate - xTimerWheelTime );
+                        xNextExpireTime = xCandidate;
+                        *pxListWasEmpty = pdFALSE;
+                    }
+                }
+            }
+
+            return xNextExpireTime;
         }
 
-        return xNextExpireTime;
-    }
+    #endif /* if ( configUSE_TIMER_WHEEL == 0 ) */
 /*-----------------------------------------------------------*/
 
     static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
     {
         TickType_t xTimeNow;
-        PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U;
 
         xTimeNow = xTaskGetTickCount();
 
-        if( xTimeNow < xLastTime )
+        #if ( configUSE_TIMER_WHEEL == 0 )
         {
-            prvSwitchTimerLists();
-            *pxTimerListsWereSwitched = pdTRUE;
+            PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U;
+
+            if( xTimeNow < xLastTime )
+            {
+                prvSwitchTimerLists();
+                *pxTimerListsWereSwitched = pdTRUE;
+            }
+            else
+            {
+                *pxTimerListsWereSwitched = pdFALSE;
+            }
+
+            xLastTime = xTimeNow;
         }
-        else
+        #else /* if ( configUSE_TIMER_WHEEL == 0 ) */
         {
+            /* The wheel does not depend on the tick count not overflowing. */
             *pxTimerListsWereSwitched = pdFALSE;
         }
-
-        xLastTime = xTimeNow;
+        #endif /* if ( configUSE_TIMER_WHEEL == 0 ) */
 
         return xTimeNow;
     }
@@ -909,7 +1135,15 @@
             }
             else
             {
-                vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+                #if ( configUSE_TIMER_WHEEL == 0 )
+                {
+                    vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+                }
+                #else
+                {
+                    prvTimerWheelInsert( pxTimer, xTimeNow );
+                }
+                #endif
             }
         }
         else
@@ -923,7 +1157,15 @@
             }
             else
             {
-                vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+                #if ( configUSE_TIMER_WHEEL == 0 )
+                {
+                    vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+                }
+                #else
+                {
+                    prvTimerWheelInsert( pxTimer, xTimeNow );
+                }
+                #endif
             }
         }
 
@@ -975,7 +1217,7 @@
                     if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
                     {
                         /* The timer is in a list, remove it. */
-                        ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+                        prvRemoveTimerFromActiveList( pxTimer );
                     }
                     else
                     {
@@ -1086,29 +1328,160 @@
     }
 /*-----------------------------------------------------------*/
 
-    static void prvSwitchTimerLists( void )
+    static void prvRemoveTimerFromActiveList( Timer_t * const pxTimer )
     {
-        TickType_t xNextExpireTime;
-        List_t * pxTemp;
+        #if ( configUSE_TIMER_WHEEL == 0 )
+        {
+            ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+        }
+        #else
+        {
+            const UBaseType_t uxSlot = ( UBaseType_t ) ( listLIST_ITEM_CONTAINER( &( pxTimer->xTimerListItem ) ) - &( xTimerWheel[ 0 ] ) );
 
-        /* The tick count has overflowed.  The timer lists must be switched.
-         * If there are any timers still referenced from the current timer list
-         * then they must have expired and should be processed before the lists
-         * are switched. */
-        while( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+            if( uxListRemove( &( pxTimer->xTimerListItem ) ) == ( UBaseType_t ) 0 )
+            {
+                ulTimerWheelOccupied[ uxSlot >> configTIMER_WHEEL_SLOT_BITS ] &= ~( ( uint32_t ) 1U << ( uxSlot & tmrWHEEL_SLOT_MASK ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* if ( configUSE_TIMER_WHEEL == 0 ) */
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TIMER_WHEEL == 0 )
+
+        static void prvSwitchTimerLists( void )
         {
-            xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+            TickType_t xNextExpireTime;
+            List_t * pxTemp;
+
+            /* The tick count has overflowed.  The timer lists must be switched.
+             * If there are any timers still referenced from the current timer list
+             * then they must have expired and should be processed before the lists
+             * are switched. */
+            while( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+            {
+                xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+
+                /* Process the expired timer.  For auto-reload timers, be careful to
+                 * process only expirations that occur on the current list.  Further
+                 * expirations must wait until after the lists are switched. */
+                prvProcessExpiredTimer( xNextExpireTime, tmrMAX_TIME_BEFORE_OVERFLOW );
+            }
 
-            /* Process the expired timer.  For auto-reload timers, be careful to
-             * process only expirations that occur on the current list.  Further
-             * expirations must wait until after the lists are switched. */
-            prvProcessExpiredTimer( xNextExpireTime, tmrMAX_TIME_BEFORE_OVERFLOW );
+            pxTemp = pxCurrentTimerList;
+            pxCurrentTimerList = pxOverflowTimerList;
+            pxOverflowTimerList = pxTemp;
         }
 
-        pxTemp = pxCurrentTimerList;
-        pxCurrentTimerList = pxOverflowTimerList;
-        pxOverflowTimerList = pxTemp;
-    }
+    #else /* if ( configUSE_TIMER_WHEEL == 0 ) */
+
+        static void prvTimerWheelInsert( Timer_t * const pxTimer,
+                                         const TickType_t xTimeNow )
+        {
+            TickType_t xSlotTime = listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) );
+            TickType_t xDelta;
+            UBaseType_t uxLevel = 0;
+            UBaseType_t uxSlot;
+
+            /* If the wheel is empty there is nothing that has to be processed
+             * before xTimeNow, so start measuring distances from there. */
+            for( uxSlot = 0; uxSlot < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxSlot++ )
+            {
+                if( ulTimerWheelOccupied[ uxSlot ] != 0U )
+                {
+                    break;
+                }
+            }
+
+            if( uxSlot == ( UBaseType_t ) configTIMER_WHEEL_LEVELS )
+            {
+                xTimerWheelTime = xTimeNow;
+            }
+
+            xDelta = ( TickType_t ) ( xSlotTime - xTimerWheelTime );
+
+            #ifdef tmrWHEEL_HORIZON
+            {
+                /* Too far away for the wheel to represent.  Park the timer in
+                 * the top level slot that is due last, from where it will be
+                 * re-filed closer to its expiry time. */
+                if( xDelta >= tmrWHEEL_HORIZON )
+                {
+                    xDelta = tmrWHEEL_HORIZON - ( TickType_t ) 1U;
+                    xSlotTime = xTimerWheelTime + xDelta;
+                }
+            }
+            #endif /* tmrWHEEL_HORIZON */
+
+            /* Use the lowest level whose span covers the distance to the
+             * expiry time. */
+            while( ( ( uxLevel + 1U ) < ( UBaseType_t ) configTIMER_WHEEL_LEVELS ) &&
+                   ( ( xDelta >> tmrWHEEL_LEVEL_SHIFT( uxLevel + 1U ) ) != ( TickType_t ) 0U ) )
+            {
+                uxLevel++;
+            }
+
+            uxSlot = ( UBaseType_t ) ( xSlotTime >> tmrWHEEL_LEVEL_SHIFT( uxLevel ) ) & tmrWHEEL_SLOT_MASK;
+
+            listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+            vListInsertEnd( &( xTimerWheel[ ( uxLevel << configTIMER_WHEEL_SLOT_BITS ) + uxSlot ] ), &( pxTimer->xTimerListItem ) );
+            ulTimerWheelOccupied[ uxLevel ] |= ( uint32_t ) 1U << uxSlot;
+        }
+/*-----------------------------------------------------------*/
+
+        static void prvTimerWheelCascade( void )
+        {
+            UBaseType_t uxLevel;
+            UBaseType_t uxSlot;
+            List_t * pxSlot;
+            Timer_t * pxTimer;
+
+            /* A slot at level n is due when every bit of the tick count below
+             * the bits that select it is zero, so only the lowest levels have to
+             * be looked at on most ticks.  Work down from the highest level so a
+             * timer can move through several levels in one go. */
+            for( uxLevel = ( UBaseType_t ) configTIMER_WHEEL_LEVELS - 1U; uxLevel > 0U; uxLevel-- )
+            {
+                if( ( xTimerWheelTime & ( ( ( TickType_t ) 1U << tmrWHEEL_LEVEL_SHIFT( uxLevel ) ) - ( TickType_t ) 1U ) ) == ( TickType_t ) 0U )
+                {
+                    uxSlot = ( UBaseType_t ) ( xTimerWheelTime >> tmrWHEEL_LEVEL_SHIFT( uxLevel ) ) & tmrWHEEL_SLOT_MASK;
+
+                    if( ( ulTimerWheelOccupied[ uxLevel ] & ( ( uint32_t ) 1U << uxSlot ) ) != 0U )
+                    {
+                        pxSlot = &( xTimerWheel[ ( uxLevel << configTIMER_WHEEL_SLOT_BITS ) + uxSlot ] );
+                        ulTimerWheelOccupied[ uxLevel ] &= ~( ( uint32_t ) 1U << uxSlot );
+
+                        /* Re-filing a timer never puts it back in this slot, as
+                         * it is now either within this slot's span, so goes to
+                         * a lower level, or is parked in a different top level
+                         * slot. */
+                        while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+                        {
+                            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                            /* coverity[misra_c_2012_rule_11_5_violation] */
+                            pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot );
+                            ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+                            prvTimerWheelInsert( pxTimer, xTimerWheelTime );
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+
+    #endif /* if ( configUSE_TIMER_WHEEL == 0 ) */
 /*-----------------------------------------------------------*/
 
     static void prvCheckForValidListAndQueue( void )
@@ -1120,10 +1493,30 @@
         {
             if( xTimerQueue == NULL )
             {
-                vListInitialise( &xActiveTimerList1 );
-                vListInitialise( &xActiveTimerList2 );
-                pxCurrentTimerList = &xActiveTimerList1;
-                pxOverflowTimerList = &xActiveTimerList2;
+                #if ( configUSE_TIMER_WHEEL == 0 )
+                {
+                    vListInitialise( &xActiveTimerList1 );
+                    vListInitialise( &xActiveTimerList2 );
+                    pxCurrentTimerList = &xActiveTimerList1;
+                    pxOverflowTimerList = &xActiveTimerList2;
+                }
+                #else
+                {
+                    UBaseType_t uxSlot;
+
+                    for( uxSlot = 0; uxSlot < ( UBaseType_t ) ( sizeof( xTimerWheel ) / sizeof( xTimerWheel[ 0 ] ) ); uxSlot++ )
+                    {
+                        vListInitialise( &( xTimerWheel[ uxSlot ] ) );
+                    }
+
+                    for( uxSlot = 0; uxSlot < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxSlot++ )
+                    {
+                        ulTimerWheelOccupied[ uxSlot ] = 0U;
+                    }
+
+                    xTimerWheelTime = ( TickType_t ) 0U;
+                }
+                #endif /* if ( configUSE_TIMER_WHEEL == 0 ) */
 
                 #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
                 {
@@ -40,9 +40,22 @@
  * See http://www.freertos.org/a00110.html
  *----------------------------------------------------------*/
 
+/* Build com os dois nucleos do RP2040 (cmake -DPICOW_DOIS_NUCLEOS=ON): o
+ * caminho de controle (joystick, freio, bateria, monitor do FPGA) fica preso
+ * ao nucleo 0 e display, buzzer e log serial ao nucleo 1 (ver a coluna
+ * 'nucleo' de TABELA_TAREFAS em tarefas_estaticas.h). */
+#ifndef USAR_DOIS_NUCLEOS
+#define USAR_DOIS_NUCLEOS                       0
+#endif
+
 /* Scheduler Related */
 #define configUSE_PREEMPTION                    1
+#if USAR_DOIS_NUCLEOS
+/* O tickless idle nao e suportado com os dois nucleos rodando tarefas */
 #define configUSE_TICKLESS_IDLE                 0
+#else
+#define configUSE_TICKLESS_IDLE                 1
+#endif
 #define configUSE_IDLE_HOOK                     0
 #define configUSE_TICK_HOOK                     0
 #define configTICK_RATE_HZ                      ( ( TickType_t ) 1000 )
@@ -52,6 +65,23 @@
 
 #define configIDLE_SHOULD_YIELD                 1
 
+/* Tickless idle: com as tarefas dormindo entre leituras de 50-200 ms, o nucleo
+ * dorme ate o proximo desbloqueio com um alarme do timer de 64 bits do RP2040
+ * em vez de acordar a cada tick.  O clock gating (estado SLEEP) fica desligado
+ * porque o stdio USB precisa dos clocks do USB durante o sono. */
+#define configUSE_RP2040_TIMER_TICKLESS_IDLE    configUSE_TICKLESS_IDLE
+#define configRP2040_TICKLESS_CLOCK_GATING      0
+
+/* Atrasos e timeouts em microssegundos (rp2040_delay_us.h), acordados por um
+ * alarme do SDK em vez do tick.  Reservam o ultimo ponteiro TLS e o indice 1
+ * de notificacao de cada tarefa. */
+#define configUSE_RP2040_US_DELAYS              1
+
+/* Atrasos de ate 255 ticks (50, 100, 150 e 200 ms das tarefas periodicas) ficam
+ * na roda de tarefas atrasadas, com bloqueio e desbloqueio O(1). */
+#define configUSE_DELAYED_TASK_WHEEL            1
+#define configDELAYED_TASK_WHEEL_SIZE           256
+
 /* Synchronization Related */
 #define configUSE_MUTEXES                       1
 #define configUSE_RECURSIVE_MUTEXES             1
@@ -59,24 +89,40 @@
 #define configUSE_COUNTING_SEMAPHORES           1
 #define configQUEUE_REGISTRY_SIZE               8
 #define configUSE_QUEUE_SETS                    1
+/* A LogTask imprime cada linha direto do armazenamento da fila
+ * (xQueueAcquire/xQueueRelease), sem copia-la para a propria pilha. */
+#define configUSE_QUEUE_ZERO_COPY               1
+/* Quem envia para uma fila vazia copia o item direto no buffer da tarefa
+ * bloqueada em xQueueReceive, sem passar pelo armazenamento da fila. */
+#define configUSE_QUEUE_HAND_OFF                1
 #define configUSE_TIME_SLICING                  1
 #define configUSE_NEWLIB_REENTRANT              0
 // todo need this for lwip FreeRTOS sys_arch to compile
 #define configENABLE_BACKWARD_COMPATIBILITY     1
 #define configNUM_THREAD_LOCAL_STORAGE_POINTERS 5
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES   2
 
 /* System */
 #define configSTACK_DEPTH_TYPE                  uint32_t
 #define configMESSAGE_BUFFER_LENGTH_TYPE        size_t
 
 /* Memory allocation related definitions. */
-#define configSUPPORT_STATIC_ALLOCATION         0
+#define configSUPPORT_STATIC_ALLOCATION         1
+#define configKERNEL_PROVIDED_STATIC_MEMORY     1
 #define configSUPPORT_DYNAMIC_ALLOCATION        1
-#define configTOTAL_HEAP_SIZE                   (128*1024)
+#define configTOTAL_HEAP_SIZE                   (16*1024)
 #define configAPPLICATION_ALLOCATED_HEAP        0
+#define configUSE_MEMORY_POOLS                  1
+#define configMEMORY_POOL_MAX_SIZE_CLASSES      4
+#define configKERNEL_OBJECTS_FROM_MEMORY_POOLS  0
+#define configHEAP_TRACE_ALLOCATIONS            0
+#define configHEAP_TRACE_BUFFER_LENGTH          64
 
 /* Hook function related definitions. */
-#define configCHECK_FOR_STACK_OVERFLOW          0
+/* Os orcamentos de TABELA_TAREFAS sao apertados e as tarefas chamam printf e
+ * vsnprintf: o metodo 2 confere o padrao no fim da pilha a cada troca de
+ * contexto e chama vApplicationStackOverflowHook (tarefas_estaticas.c). */
+#define configCHECK_FOR_STACK_OVERFLOW          2
 #define configUSE_MALLOC_FAILED_HOOK            0
 #define configUSE_DAEMON_TASK_STARTUP_HOOK      0
 
@@ -94,6 +140,9 @@
 #define configTIMER_TASK_PRIORITY               ( configMAX_PRIORITIES - 1 )
 #define configTIMER_QUEUE_LENGTH                10
 #define configTIMER_TASK_STACK_DEPTH            1024
+#define configUSE_TIMER_WHEEL                   1
+#define configTIMER_WHEEL_SLOT_BITS             4
+#define configTIMER_WHEEL_LEVELS                4
 
 /* Interrupt nesting behaviour configuration. */
 /*
@@ -104,15 +153,27 @@
 
 #if FREE_RTOS_KERNEL_SMP // set by the RP2040 SMP port of FreeRTOS
 /* SMP port only */
+#if USAR_DOIS_NUCLEOS
+#define configNUMBER_OF_CORES                   2
+#define configUSE_CORE_AFFINITY                 1
+/* Quem acha um mutex ocupado gira ate 50 passadas enquanto o dono roda no
+ * outro nucleo, antes de bloquear */
+#define configMUTEX_SPIN_ITERATIONS             50
+#else
 #define configNUMBER_OF_CORES                   1
+#define configUSE_CORE_AFFINITY                 0
+#endif
 #define configTICK_CORE                         0
 #define configRUN_MULTIPLE_PRIORITIES           1
-#define configUSE_CORE_AFFINITY                 0
+#define configUSE_PASSIVE_IDLE_HOOK             0
 #endif
 
 /* RP2040 specific */
 #define configSUPPORT_PICO_SYNC_INTEROP         1
 #define configSUPPORT_PICO_TIME_INTEROP         1
+#define configUSE_RP2040_BANKED_ALLOCATION      1
+#define configRP2040_SCRATCH_X_ARENA_SIZE       1280
+#define configRP2040_SCRATCH_Y_ARENA_SIZE       1280
 
 #include <assert.h>
 /* Define to trap errors during development. */
@@ -1,5 +1,7 @@
 #include "battery_task.h"
 #include <stdio.h>
+#include "tarefas_estaticas.h"
+#include "log_serial.h"
 
 // ------------------------------------------------------------
 // Protótipo da função de tarefa
@@ -18,14 +20,7 @@ void battery_task_init(UBaseType_t prioridade) {
     gpio_set_dir(PIN_FPGA_BATTERY, GPIO_OUT);
     gpio_put(PIN_FPGA_BATTERY, 0);   // inicia em nível baixo
 
-    xTaskCreate(
-        vTaskBatteryButton,
-        "BatteryTask",
-        1024,
-        NULL,
-        prioridade,
-        NULL
-    );
+    criar_tarefa_estatica(TAREFA_BATERIA, vTaskBatteryButton, NULL, prioridade);
 
     printf("🟢 Battery task iniciada (GPIO6 → GPIO9)\n");
 }
@@ -44,9 +39,9 @@ static void vTaskBatteryButton(void *pvParameters) {
             gpio_put(PIN_FPGA_BATTERY, botao_pressionado ? 1 : 0);
 
             if (botao_pressionado)
-                printf("[BATERIA] Botão B pressionado -> GPIO9 = HIGH\n");
+                log_printf("[BATERIA] Botão B pressionado -> GPIO9 = HIGH\n");
             else
-                printf("[BATERIA] Botão B solto -> GPIO9 = LOW\n");
+                log_printf("[BATERIA] Botão B solto -> GPIO9 = LOW\n");
         }
 
         vTaskDelay(pdMS_TO_TICKS(50));
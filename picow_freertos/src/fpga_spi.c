@@ -0,0 +1,200 @@
+// ===========================================
+// fpga_spi.c
+// ===========================================
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/spi.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "FreeRTOS.h"
+#include "semphr.h"
+#include "fpga_spi.h"
+
+#define FPGA_SPI                spi0
+#define FPGA_SPI_BYTES_MAX      (1 + 4 * FPGA_SPI_MAX_PALAVRAS)
+#define FPGA_SPI_TIMEOUT_MS     10
+
+// ============================================================
+// ESTADO DO ENLACE (estático)
+// ============================================================
+static uint8_t buf_tx[FPGA_SPI_BYTES_MAX];
+static uint8_t buf_rx[FPGA_SPI_BYTES_MAX];
+
+static int canal_tx;
+static int canal_rx;
+
+// Uma transação por vez; o DMA avisa o fim pelo semáforo
+static StaticSemaphore_t estrutura_mutex;
+static SemaphoreHandle_t mutex_spi;
+static StaticSemaphore_t estrutura_fim;
+static SemaphoreHandle_t sem_fim;
+
+// ------------------------------------------------------------
+// Fim da rajada: o canal RX termina por último
+// ------------------------------------------------------------
+static void dma_fim_isr(void) {
+    if (!dma_channel_get_irq0_status(canal_rx))
+        return;
+
+    dma_channel_acknowledge_irq0(canal_rx);
+
+    BaseType_t acordou = pdFALSE;
+    xSemaphoreGiveFromISR(sem_fim, &acordou);
+    portYIELD_FROM_ISR(acordou);
+}
+
+// ============================================================
+// Inicialização
+// ============================================================
+void fpga_spi_init(void) {
+    spi_init(FPGA_SPI, FPGA_SPI_HZ);
+    spi_set_format(FPGA_SPI, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+    gpio_set_function(FPGA_SPI_SCK_PIN, GPIO_FUNC_SPI);
+    gpio_set_function(FPGA_SPI_MOSI_PIN, GPIO_FUNC_SPI);
+    gpio_set_function(FPGA_SPI_MISO_PIN, GPIO_FUNC_SPI);
+
+    // CS por software: o CSn do PL022 sobe entre bytes no modo 0
+    gpio_init(FPGA_SPI_CS_PIN);
+    gpio_set_dir(FPGA_SPI_CS_PIN, GPIO_OUT);
+    gpio_put(FPGA_SPI_CS_PIN, 1);
+
+    mutex_spi = xSemaphoreCreateMutexStatic(&estrutura_mutex);
+    sem_fim   = xSemaphoreCreateBinaryStatic(&estrutura_fim);
+
+    canal_tx = dma_claim_unused_channel(true);
+    canal_rx = dma_claim_unused_channel(true);
+
+    dma_channel_config c = dma_channel_get_default_config(canal_tx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, spi_get_dreq(FPGA_SPI, true));
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    dma_channel_configure(canal_tx, &c, &spi_get_hw(FPGA_SPI)->dr, buf_tx, 0, false);
+
+    c = dma_channel_get_default_config(canal_rx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, spi_get_dreq(FPGA_SPI, false));
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    dma_channel_configure(canal_rx, &c, buf_rx, &spi_get_hw(FPGA_SPI)->dr, 0, false);
+
+    dma_channel_set_irq0_enabled(canal_rx, true);
+    irq_add_shared_handler(DMA_IRQ_0, dma_fim_isr, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+}
+
+// ------------------------------------------------------------
+// Uma transação de 'bytes' bytes já montada em buf_tx
+// ------------------------------------------------------------
+static bool transferir(size_t bytes) {
+    gpio_put(FPGA_SPI_CS_PIN, 0);
+    busy_wait_us_32(1);     // o FPGA leva 3 ciclos para ver o CS
+
+    dma_channel_set_read_addr(canal_tx, buf_tx, false);
+    dma_channel_set_trans_count(canal_tx, bytes, false);
+    dma_channel_set_write_addr(canal_rx, buf_rx, false);
+    dma_channel_set_trans_count(canal_rx, bytes, false);
+    dma_start_channel_mask((1u << canal_tx) | (1u << canal_rx));
+
+    bool ok = xSemaphoreTake(sem_fim, pdMS_TO_TICKS(FPGA_SPI_TIMEOUT_MS)) == pdTRUE;
+    if (!ok) {
+        dma_channel_abort(canal_tx);
+        dma_channel_abort(canal_rx);
+        // Espera o byte em curso e esvazia a FIFO de RX, senão a
+        // próxima rajada começa lendo bytes desta
+        while (spi_is_busy(FPGA_SPI))
+            tight_loop_contents();
+        while (spi_is_readable(FPGA_SPI))
+            (void) spi_get_hw(FPGA_SPI)->dr;
+        // Descarta um aviso que chegou depois do timeout
+        xSemaphoreTake(sem_fim, 0);
+    }
+
+    gpio_put(FPGA_SPI_CS_PIN, 1);
+    return ok;
+}
+
+// ============================================================
+// Leitura e escrita de registradores
+// ============================================================
+// Quem chama já tem o mutex_spi
+static bool ler_registros(uint8_t reg, uint32_t *dados, size_t n, uint8_t *status) {
+    configASSERT(n <= FPGA_SPI_MAX_PALAVRAS);
+
+    buf_tx[0] = reg & 0x7F;
+    memset(&buf_tx[1], 0, 4 * n);
+    bool ok = transferir(1 + 4 * n);
+
+    if (ok) {
+        if (status != NULL)
+            *status = buf_rx[0];
+        for (size_t i = 0; i < n; i++) {
+            const uint8_t *p = &buf_rx[1 + 4 * i];
+            dados[i] = ((uint32_t) p[0] << 24) | ((uint32_t) p[1] << 16) |
+                       ((uint32_t) p[2] << 8)  |  (uint32_t) p[3];
+        }
+    }
+
+    return ok;
+}
+
+bool fpga_spi_ler(uint8_t reg, uint32_t *dados, size_t n, uint8_t *status) {
+    xSemaphoreTake(mutex_spi, portMAX_DELAY);
+    bool ok = ler_registros(reg, dados, n, status);
+    xSemaphoreGive(mutex_spi);
+    return ok;
+}
+
+bool fpga_spi_escrever(uint8_t reg, uint32_t valor) {
+    xSemaphoreTake(mutex_spi, portMAX_DELAY);
+
+    buf_tx[0] = 0x80 | (reg & 0x7F);
+    buf_tx[1] = (uint8_t) (valor >> 24);
+    buf_tx[2] = (uint8_t) (valor >> 16);
+    buf_tx[3] = (uint8_t) (valor >> 8);
+    buf_tx[4] = (uint8_t) valor;
+    bool ok = transferir(5);
+
+    xSemaphoreGive(mutex_spi);
+    return ok;
+}
+
+// ============================================================
+// Eventos: lê o nível e retira exatamente esse número de pares
+// EVT_TS/EVT_INFO, para não tirar da FIFO mais do que cabe aqui.
+// As duas leituras vão com o mutex_spi, que também protege
+// 'palavras' (estático para não pesar na pilha do monitor).
+// ============================================================
+size_t fpga_spi_ler_eventos(fpga_evento_t *eventos, size_t max) {
+    static uint32_t palavras[FPGA_SPI_MAX_PALAVRAS];
+    size_t lidos = 0;
+
+    if (max > FPGA_SPI_MAX_PALAVRAS / 2)
+        max = FPGA_SPI_MAX_PALAVRAS / 2;
+
+    xSemaphoreTake(mutex_spi, portMAX_DELAY);
+
+    size_t n = 0;
+    if (ler_registros(FPGA_REG_EVT_NIVEL, palavras, 1, NULL))
+        n = palavras[0] & 0xFFFF;
+    if (n > max)
+        n = max;
+    if (n == 0 || !ler_registros(FPGA_REG_EVT_TS, palavras, 2 * n, NULL)) {
+        xSemaphoreGive(mutex_spi);
+        return 0;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        uint32_t info = palavras[2 * i + 1];
+        if (!(info & 0x80000000u))
+            continue;
+        eventos[lidos].ciclo       = palavras[2 * i];
+        eventos[lidos].modo_antigo = (info >> 8) & 0x7;
+        eventos[lidos].modo_novo   = (info >> 5) & 0x7;
+        eventos[lidos].entradas    = info & 0x1F;
+        lidos++;
+    }
+
+    xSemaphoreGive(mutex_spi);
+    return lidos;
+}
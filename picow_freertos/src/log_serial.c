@@ -0,0 +1,83 @@
+// ===========================================
+// log_serial.c
+// ===========================================
+#include <stdarg.h>
+#include <stdio.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "log_serial.h"
+#include "tarefas_estaticas.h"
+
+// ============================================================
+// FILA DE MENSAGENS (estática)
+// ============================================================
+static uint8_t armazenamento_fila[LOG_FILA_TAMANHO * LOG_LINHA_MAX];
+static StaticQueue_t estrutura_fila;
+static QueueHandle_t fila_log = NULL;
+
+// Mensagens perdidas com a fila cheia (escritas pelos dois núcleos)
+static uint32_t descartadas = 0;
+
+// ============================================================
+// Envio sem bloqueio: a linha é formatada direto no slot da fila
+// ============================================================
+void log_printf(const char *fmt, ...) {
+    char *linha;
+    va_list args;
+
+    // Antes do escalonador não há quem esvazie a fila
+    if (fila_log == NULL || xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED) {
+        va_start(args, fmt);
+        vprintf(fmt, args);
+        va_end(args);
+        return;
+    }
+
+    // Fila cheia, ou outra tarefa formatando no slot reservado
+    if (xQueueReserve(fila_log, (void **) &linha, 0) != pdPASS) {
+        taskENTER_CRITICAL();
+        descartadas++;
+        taskEXIT_CRITICAL();
+        return;
+    }
+
+    va_start(args, fmt);
+    vsnprintf(linha, LOG_LINHA_MAX, fmt, args);
+    va_end(args);
+
+    xQueueCommit(fila_log, linha);
+}
+
+// ============================================================
+// Tarefa que escreve no stdio (único escritor em regime)
+// ============================================================
+static void task_log(void *params) {
+    (void) params;
+    char *linha;
+
+    for (;;) {
+        // A linha é lida no lugar; o slot só volta para os produtores
+        // depois do xQueueRelease(), quando a escrita USB terminou.
+        xQueueAcquire(fila_log, (void **) &linha, portMAX_DELAY);
+
+        taskENTER_CRITICAL();
+        uint32_t perdidas = descartadas;
+        descartadas = 0;
+        taskEXIT_CRITICAL();
+
+        if (perdidas > 0)
+            printf("[LOG] %u mensagens descartadas (fila cheia)\n", (unsigned) perdidas);
+
+        printf("%s", linha);
+        xQueueRelease(fila_log, linha);
+    }
+}
+
+void criar_tarefa_log(UBaseType_t prioridade) {
+    fila_log = xQueueCreateStatic(LOG_FILA_TAMANHO, LOG_LINHA_MAX,
+                                  armazenamento_fila, &estrutura_fila);
+    configASSERT(fila_log != NULL);
+
+    criar_tarefa_estatica(TAREFA_LOG, task_log, NULL, prioridade);
+}
@@ -9,6 +9,8 @@
 #include "tarefa_fpga_monitor.h"
 #include "tarefa_display.h"
 #include "tarefa_buzzer.h"
+#include "tarefas_estaticas.h"
+#include "log_serial.h"
 
 // ==== Header da variável global compartilhada ====
 #include "modo_global.h"
@@ -25,12 +27,14 @@ int main() {
     stdio_init_all();
 
     // ==== Criação das tarefas principais ====
+    criar_tarefa_log(1);            // Único escritor do stdio USB (núcleo 1 no build SMP)
     criar_tarefa_joystick(1);       // Leitura do joystick e envio de sinais ao FPGA
     criar_tarefa_freio(1);          // Botão A -> freio (GPIO5 → GPIO8)
     battery_task_init(1);           // Botão B -> simulação de bateria (GPIO6 → GPIO9)
     criar_tarefa_fpga_monitor(1);   // LEDs RGB + feedback serial (GPIO28/16/17)
-    xTaskCreate(task_display, "DisplayTask", 2048, NULL, 1, NULL);   // OLED SSD1306
-    xTaskCreate(task_buzzer,  "BuzzerTask",  1024, NULL, 1, NULL);   // Buzzers PWM
+    criar_tarefa_estatica(TAREFA_DISPLAY, task_display, NULL, 1);   // OLED SSD1306
+    criar_tarefa_estatica(TAREFA_BUZZER,  task_buzzer,  NULL, 1);   // Buzzers PWM
+    iniciar_medicao_pilhas();       // Só atua com MEDIR_PILHAS = 1
 
     // ==== Mensagens informativas ====
     printf("\n=========================================\n");
@@ -38,7 +42,10 @@ int main() {
     printf("=========================================\n");
     printf("Display OLED ativo, aguardando sinais do FPGA...\n");
     printf("Buzzer ativo, aguardando modo REGEN. FREIO...\n");
-    printf("Tarefas criadas: joystick, freio, bateria, monitor, display e buzzer.\n");
+    printf("Tarefas criadas: joystick, freio, bateria, monitor, display, buzzer e log.\n");
+#if USAR_DOIS_NUCLEOS
+    printf("SMP: controle no núcleo 0, display/buzzer/log no núcleo 1.\n");
+#endif
 
     // ==== Inicia o escalonador do FreeRTOS ====
     vTaskStartScheduler();
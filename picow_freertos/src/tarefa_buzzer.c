@@ -8,6 +8,7 @@
 #include "pico/stdlib.h"
 #include <stdio.h>
 #include "modo_global.h"
+#include "log_serial.h"
 
 // ==== Pinos dos buzzers ====
 #define BUZZER_A 21
@@ -62,12 +63,12 @@ static void pwm_set_buzzer(buzzer_t *bz, uint8_t duty_percent) {
 void task_buzzer(void *params) {
     pwm_init_buzzer(&buzzerA, BUZZER_A, BUZZER_FREQ_HZ);
     pwm_init_buzzer(&buzzerB, BUZZER_B, BUZZER_FREQ_HZ);
-    printf("[BUZZER] Inicializado em %d Hz (GPIO21 / GPIO10)\n", BUZZER_FREQ_HZ);
+    log_printf("[BUZZER] Inicializado em %d Hz (GPIO21 / GPIO10)\n", BUZZER_FREQ_HZ);
 
     bool toggle = false;
 
     for (;;) {
-        uint8_t modo = modo_atual;
+        uint8_t modo = modo_ler();
 
         if (modo == 0b100) { // Modo REGEN. FREIO
             toggle = !toggle;
@@ -12,6 +12,7 @@
 #include <string.h>
 #include <stdio.h>
 #include "modo_global.h"   // <-- Importa a variável global
+#include "log_serial.h"
 
 // ==== Configurações do display ====
 #define I2C_PORT i2c1
@@ -57,7 +58,7 @@ void task_display(void *params) {
     // Delay inicial para estabilizar I2C
     vTaskDelay(pdMS_TO_TICKS(500));
 
-    printf("[DISPLAY] Inicializando OLED SSD1306...\n");
+    log_printf("[DISPLAY] Inicializando OLED SSD1306...\n");
     i2c_init_display();
 
     ssd1306_t oled;
@@ -65,20 +66,11 @@ void task_display(void *params) {
     ssd1306_config(&oled);
     ssd1306_init();
 
-    // Configura pinos de entrada (sinais do FPGA)
-    gpio_init(FPGA_SIGNAL_R);
-    gpio_set_dir(FPGA_SIGNAL_R, GPIO_IN);
-    gpio_pull_down(FPGA_SIGNAL_R);
+    // Os pinos de entrada (sinais do FPGA) já foram configurados por
+    // criar_tarefa_fpga_monitor() antes do escalonador; refazer gpio_init()
+    // aqui reiniciaria os pinos enquanto o monitor os lê no outro núcleo.
 
-    gpio_init(FPGA_SIGNAL_G);
-    gpio_set_dir(FPGA_SIGNAL_G, GPIO_IN);
-    gpio_pull_down(FPGA_SIGNAL_G);
-
-    gpio_init(FPGA_SIGNAL_B);
-    gpio_set_dir(FPGA_SIGNAL_B, GPIO_IN);
-    gpio_pull_down(FPGA_SIGNAL_B);
-
-    printf("[DISPLAY] Aguardando sinais do FPGA (GPIO28/16/17)...\n");
+    log_printf("[DISPLAY] Aguardando sinais do FPGA (GPIO28/16/17)...\n");
 
     uint8_t last_code = 0xFF;
     char line1[32];
@@ -96,8 +88,8 @@ void task_display(void *params) {
         // Atualiza apenas se o código mudar
         if (code != last_code) {
             last_code = code;
-            modo_atual = code; // <-- Atualiza o modo global
-            printf("[DISPLAY] FPGA -> Novo modo: %03b (%s)\n", code, nome_modo(code));
+            modo_publicar(code); // <-- Atualiza o modo global
+            log_printf("[DISPLAY] FPGA -> Novo modo: %03b (%s)\n", code, nome_modo(code));
         }
 
         // Limpa tela
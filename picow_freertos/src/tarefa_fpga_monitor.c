@@ -1,5 +1,8 @@
 #include "tarefa_fpga_monitor.h"
 #include <stdio.h>
+#include "tarefas_estaticas.h"
+#include "log_serial.h"
+#include "fpga_spi.h"
 
 // ============================================================
 // DEFINIÇÕES DE PINOS (sinais do FPGA e LEDs RGB)
@@ -12,6 +15,8 @@
 #define LED_G_PIN     11   // LED RGB Verde
 #define LED_B_PIN     12   // LED RGB Azul
 
+#define EVENTOS_POR_LEITURA  8
+
 // ------------------------------------------------------------
 // Protótipo interno da tarefa
 // ------------------------------------------------------------
@@ -60,17 +65,13 @@ void criar_tarefa_fpga_monitor(UBaseType_t prioridade) {
     gpio_put(LED_G_PIN, 0);
     gpio_put(LED_B_PIN, 0);
 
+    // Enlace SPI com os registradores do FPGA
+    fpga_spi_init();
+
     // Cria a tarefa RTOS
-    xTaskCreate(
-        task_fpga_monitor,
-        "FPGA_Monitor",
-        1024,
-        NULL,
-        prioridade,
-        NULL
-    );
-
-    printf("Tarefa FPGA Monitor iniciada (GPIO 28/16/17)\n");
+    criar_tarefa_estatica(TAREFA_FPGA_MONITOR, task_fpga_monitor, NULL, prioridade);
+
+    printf("Tarefa FPGA Monitor iniciada (GPIO 28/16/17 + SPI0)\n");
 }
 
 // ------------------------------------------------------------
@@ -78,6 +79,16 @@ void criar_tarefa_fpga_monitor(UBaseType_t prioridade) {
 // ------------------------------------------------------------
 static void task_fpga_monitor(void *pvParameters) {
     uint8_t last_code = 0xFF; // valor impossível inicial
+    static fpga_evento_t eventos[EVENTOS_POR_LEITURA];
+
+    // Sem o FPGA com a interface SPI, o ID não confere e o monitor
+    // segue só com os 3 pinos de modo
+    uint32_t id = 0;
+    bool spi_ok = fpga_spi_ler(FPGA_REG_ID, &id, 1, NULL) && id == FPGA_ID_ESPERADO;
+    if (spi_ok)
+        log_printf("📶 FPGA → SPI ativo (ID %08lx), lendo eventos da FIFO\n", (unsigned long) id);
+    else
+        log_printf("📶 FPGA → SPI sem resposta (ID %08lx), usando só GPIO\n", (unsigned long) id);
 
     for (;;) {
         bool sig_r = gpio_get(FPGA_SIGNAL_R);
@@ -92,12 +103,24 @@ static void task_fpga_monitor(void *pvParameters) {
         // Combina sinais num código de 3 bits (bit2: B, bit1: G, bit0: R)
         uint8_t code = (sig_b << 2) | (sig_g << 1) | sig_r;
 
-        // Se o código mudou, imprime feedback
-        if (code != last_code) {
-            printf("📶 FPGA → Novo código recebido: %03b (%s)\n", code, nome_modo(code));
-            last_code = code;
+        // Com SPI, as trocas vêm da FIFO de eventos do FPGA, com o
+        // timestamp de cada uma, mesmo as mais rápidas que o polling
+        uint8_t status = 0;
+        if (spi_ok && fpga_spi_ler(FPGA_REG_STATUS, NULL, 0, &status) &&
+            (status & FPGA_STATUS_EVENTO)) {
+            size_t n = fpga_spi_ler_eventos(eventos, EVENTOS_POR_LEITURA);
+            for (size_t i = 0; i < n; i++) {
+                log_printf("📶 FPGA → %s → %s em %lu us\n",
+                           nome_modo(eventos[i].modo_antigo), nome_modo(eventos[i].modo_novo),
+                           (unsigned long) (eventos[i].ciclo / (FPGA_CLK_HZ / 1000000)));
+            }
         }
 
+        // Se o código mudou, imprime feedback
+        if (!spi_ok && code != last_code)
+            log_printf("📶 FPGA → Novo código recebido: %03b (%s)\n", code, nome_modo(code));
+        last_code = code;
+
         vTaskDelay(pdMS_TO_TICKS(100));
     }
 }
@@ -4,6 +4,8 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include "tarefa_freio.h"
+#include "tarefas_estaticas.h"
+#include "log_serial.h"
 
 #define BOTAO_FREIO_PIN 5
 #define FPGA_FREIO_PIN  8
@@ -18,7 +20,7 @@ void task_freio(void *pvParameters) {
     gpio_put(FPGA_FREIO_PIN, 0);
 
     vTaskDelay(pdMS_TO_TICKS(1000)); // Espera inicial
-    printf("[FREIO] Tarefa iniciada: pressione o botão A (GPIO5) para enviar sinal via GPIO8.\n");
+    log_printf("[FREIO] Tarefa iniciada: pressione o botão A (GPIO5) para enviar sinal via GPIO8.\n");
 
     bool estado_anterior = false;
 
@@ -30,9 +32,9 @@ void task_freio(void *pvParameters) {
             gpio_put(FPGA_FREIO_PIN, botao_pressionado ? 1 : 0);
 
             if (botao_pressionado)
-                printf("[FREIO] Freio acionado -> GPIO8 = HIGH\n");
+                log_printf("[FREIO] Freio acionado -> GPIO8 = HIGH\n");
             else
-                printf("[FREIO] Freio solto -> GPIO8 = LOW\n");
+                log_printf("[FREIO] Freio solto -> GPIO8 = LOW\n");
         }
 
         vTaskDelay(pdMS_TO_TICKS(50));
@@ -40,5 +42,5 @@ void task_freio(void *pvParameters) {
 }
 
 void criar_tarefa_freio(UBaseType_t prio) {
-    xTaskCreate(task_freio, "FreioTask", 1024, NULL, prio, NULL);
+    criar_tarefa_estatica(TAREFA_FREIO, task_freio, NULL, prio);
 }
@@ -3,8 +3,11 @@
 #include "hardware/adc.h"
 #include "FreeRTOS.h"
 #include "task.h"
+#include "rp2040_delay_us.h"
 #include <stdbool.h>
 #include <stdio.h>
+#include "tarefas_estaticas.h"
+#include "log_serial.h"
 
 // ================================================================
 // CONFIGURAÇÕES DO SISTEMA
@@ -54,7 +57,7 @@ void tarefa_joystick(void *params) {
     adc_gpio_init(27);  // VRx → GPIO27 → ADC1
     adc_select_input(ADC_VRY_CH);
 
-    printf("\n[JOYSTICK] Calibrando... mantenha o joystick parado.\n");
+    log_printf("\n[JOYSTICK] Calibrando... mantenha o joystick parado.\n");
     vTaskDelay(pdMS_TO_TICKS(1000));
 
     uint16_t calib_center_y = 0;
@@ -67,12 +70,16 @@ void tarefa_joystick(void *params) {
     adc_select_input(ADC_VRX_CH);
     calib_center_x = adc_read();
 
-    printf("[JOYSTICK] Calibração concluída.\n");
-    printf(" - Centro Y = %u | Centro X = %u\n", calib_center_y, calib_center_x);
-    printf("[JOYSTICK] Monitorando aceleração...\n");
+    log_printf("[JOYSTICK] Calibração concluída.\n");
+    log_printf(" - Centro Y = %u | Centro X = %u\n", calib_center_y, calib_center_x);
+    log_printf("[JOYSTICK] Monitorando aceleração...\n");
 
     bool last_low = false, last_high = false, last_idle = true;
 
+    // Período fixo medido no timer de 1 µs: não acumula o tempo de execução
+    // do laço nem o jitter de até 1 tick do vTaskDelay
+    uint64_t ultimo_despertar_us = time_us_64();
+
     for (;;) {
         // Lê eixo Y (controle de potência)
         adc_select_input(ADC_VRY_CH);
@@ -99,7 +106,7 @@ void tarefa_joystick(void *params) {
 
         // Log apenas quando houver mudança de estado
         if (p_demand_low != last_low || p_demand_high != last_high || p_idle != last_idle) {
-            printf("[JOY] Potência = %3d%% | LOW=%d HIGH=%d IDLE=%d | SW=%d\n",
+            log_printf("[JOY] Potência = %3d%% | LOW=%d HIGH=%d IDLE=%d | SW=%d\n",
                    power_demand,
                    p_demand_low, p_demand_high, p_idle,
                    sw_pressed);
@@ -109,7 +116,7 @@ void tarefa_joystick(void *params) {
             last_idle = p_idle;
         }
 
-        vTaskDelay(pdMS_TO_TICKS(PERIOD_MS));
+        xPortTaskDelayUntilUs(&ultimo_despertar_us, PERIOD_MS * 1000u);
     }
 }
 
@@ -117,13 +124,5 @@ void tarefa_joystick(void *params) {
 // Criação da tarefa no FreeRTOS
 // ================================================================
 void criar_tarefa_joystick(UBaseType_t prio) {
-    BaseType_t ok = xTaskCreate(
-        tarefa_joystick,
-        "JoystickTask",
-        2048,
-        NULL,
-        prio,
-        &handle_joy
-    );
-    configASSERT(ok == pdPASS);
+    handle_joy = criar_tarefa_estatica(TAREFA_JOYSTICK, tarefa_joystick, NULL, prio);
 }
@@ -0,0 +1,178 @@
+// ===========================================
+// tarefas_estaticas.c
+// ===========================================
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "tarefas_estaticas.h"
+
+// ============================================================
+// BUFFERS ESTÁTICOS (gerados a partir de TABELA_TAREFAS)
+// ------------------------------------------------------------
+// Tarefas no banco STRIPED recebem pilha e TCB em .bss; tarefas nos
+// bancos SCRATCH_X/Y são carregadas das arenas do port RP2040.
+// ============================================================
+#define BUFFERS_STRIPED(id, pilha)                                      \
+    static StackType_t pilha_##id[pilha];                               \
+    static StaticTask_t tcb_##id;
+#define BUFFERS_SCRATCH_X(id, pilha)
+#define BUFFERS_SCRATCH_Y(id, pilha)
+
+#define PILHA_STRIPED(id)       pilha_##id
+#define PILHA_SCRATCH_X(id)     NULL
+#define PILHA_SCRATCH_Y(id)     NULL
+
+#define TCB_STRIPED(id)         &tcb_##id
+#define TCB_SCRATCH_X(id)       NULL
+#define TCB_SCRATCH_Y(id)       NULL
+
+#define TAREFA_BUFFERS(id, nome, pilha, banco, nucleo)  BUFFERS_##banco(id, pilha)
+TABELA_TAREFAS(TAREFA_BUFFERS)
+
+typedef struct {
+    const char *nome;
+    configSTACK_DEPTH_TYPE pilha;
+    UBaseType_t banco;
+    const char *nome_banco;
+    StackType_t *buffer_pilha;
+    StaticTask_t *buffer_tcb;
+    UBaseType_t nucleo;
+    const char *nome_nucleo;
+} tarefa_desc_t;
+
+#define TAREFA_DESC(id, nome, pilha, banco, nucleo) \
+    [id] = { nome, pilha, portRP2040_BANK_##banco, #banco, PILHA_##banco(id), TCB_##banco(id), \
+             NUCLEO_##nucleo, #nucleo },
+
+// Um banco scratch só serve à tarefa presa ao núcleo dono dele; no
+// outro núcleo ela disputaria o banco com a pilha principal de lá
+#define TAREFA_BANCO_OK(id, nome, pilha, banco, nucleo)                 \
+    _Static_assert(portRP2040_BANK_##banco == portRP2040_BANK_STRIPED ||  \
+                   portRP2040_BANK_##banco == portRP2040_BANK_FOR_CORE(NUCLEO_##nucleo), \
+                   nome ": banco scratch de outro nucleo");
+TABELA_TAREFAS(TAREFA_BANCO_OK)
+
+static const tarefa_desc_t tarefas[NUM_TAREFAS] = {
+    TABELA_TAREFAS(TAREFA_DESC)
+};
+
+static TaskHandle_t handles[NUM_TAREFAS];
+
+// ============================================================
+// Criação das tarefas sem heap
+// ============================================================
+TaskHandle_t criar_tarefa_estatica(tarefa_id_t id, TaskFunction_t funcao,
+                                   void *params, UBaseType_t prioridade) {
+    configASSERT(id < NUM_TAREFAS);
+    const tarefa_desc_t *t = &tarefas[id];
+
+    if (t->banco == portRP2040_BANK_STRIPED) {
+        handles[id] = xTaskCreateStatic(funcao, t->nome, t->pilha, params,
+                                        prioridade, t->buffer_pilha, t->buffer_tcb);
+    } else {
+        // Se a arena do banco não couber a tarefa, o port cai para o heap
+        BaseType_t ok = xPortTaskCreateInBank(funcao, t->nome, t->pilha, params,
+                                              prioridade, t->banco, &handles[id]);
+        if (ok != pdPASS)
+            handles[id] = NULL;
+    }
+
+    configASSERT(handles[id] != NULL);
+
+#if ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_AFFINITY == 1 )
+    // O escalonador ainda não rodou, então a tarefa já nasce no núcleo certo
+    if (handles[id] != NULL)
+        vTaskCoreAffinitySet(handles[id], (UBaseType_t) 1 << t->nucleo);
+#endif
+
+    return handles[id];
+}
+
+// ============================================================
+// Estouro de pilha (configCHECK_FOR_STACK_OVERFLOW = 2)
+// ------------------------------------------------------------
+// Chamado na troca de contexto, com a pilha da tarefa já passada do
+// fim: não dá para continuar nem confiar na fila de log, então para
+// tudo com o nome da tarefa.  Aumente o orçamento dela na tabela.
+// ============================================================
+void vApplicationStackOverflowHook(TaskHandle_t tarefa, char *nome) {
+    (void) tarefa;
+    taskDISABLE_INTERRUPTS();
+    panic("[PILHAS] estouro de pilha em %s", nome);
+}
+
+#if MEDIR_PILHAS
+// ============================================================
+// MODO DE MEDIÇÃO: imprime a tabela com as pilhas reajustadas
+// ============================================================
+#define PILHA_MEDICAO           256
+#define PILHA_ARREDONDAMENTO    32   // múltiplo usado na tabela gerada
+
+static StackType_t pilha_medicao[PILHA_MEDICAO];
+static StaticTask_t tcb_medicao;
+
+static void task_medicao_pilhas(void *params) {
+    (void) params;
+
+    vTaskDelay(pdMS_TO_TICKS(MEDIR_PILHAS_SOAK_MS));
+
+    printf("\n[PILHAS] Uso de pilha após %u ms (palavras):\n", (unsigned) MEDIR_PILHAS_SOAK_MS);
+    printf("[PILHAS] %-14s %8s %8s %8s\n", "tarefa", "orcado", "usado", "sugerido");
+
+    configSTACK_DEPTH_TYPE sugerida[NUM_TAREFAS];
+
+    for (int i = 0; i < NUM_TAREFAS; i++) {
+        const tarefa_desc_t *t = &tarefas[i];
+        configSTACK_DEPTH_TYPE usado = 0;
+
+        if (handles[i] != NULL)
+            usado = t->pilha - uxTaskGetStackHighWaterMark(handles[i]);
+
+        configSTACK_DEPTH_TYPE s = usado + (usado * MEDIR_PILHAS_MARGEM_PCT) / 100;
+        if (s < configMINIMAL_STACK_SIZE)
+            s = configMINIMAL_STACK_SIZE;
+        sugerida[i] = (s + PILHA_ARREDONDAMENTO - 1) & ~(configSTACK_DEPTH_TYPE) (PILHA_ARREDONDAMENTO - 1);
+
+        printf("[PILHAS] %-14s %8u %8u %8u\n", t->nome,
+               (unsigned) t->pilha, (unsigned) usado, (unsigned) sugerida[i]);
+    }
+
+#if ( configNUMBER_OF_CORES > 1 )
+    for (BaseType_t n = 0; n < configNUMBER_OF_CORES; n++) {
+        printf("[PILHAS] IDLE%-10d %8u %8u\n", (int) n, (unsigned) configMINIMAL_STACK_SIZE,
+               (unsigned) (configMINIMAL_STACK_SIZE - uxTaskGetStackHighWaterMark(xTaskGetIdleTaskHandleForCore(n))));
+    }
+#else
+    printf("[PILHAS] %-14s %8u %8u\n", "IDLE", (unsigned) configMINIMAL_STACK_SIZE,
+           (unsigned) (configMINIMAL_STACK_SIZE - uxTaskGetStackHighWaterMark(xTaskGetIdleTaskHandle())));
+#endif
+    printf("[PILHAS] %-14s %8u %8u\n", "Tmr Svc", (unsigned) configTIMER_TASK_STACK_DEPTH,
+           (unsigned) (configTIMER_TASK_STACK_DEPTH - uxTaskGetStackHighWaterMark(xTimerGetTimerDaemonTaskHandle())));
+
+    // Tabela pronta para colar em tarefas_estaticas.h
+    static const char *ids[NUM_TAREFAS] = {
+#define TAREFA_ID_STR(id, nome, pilha, banco, nucleo) [id] = #id,
+        TABELA_TAREFAS(TAREFA_ID_STR)
+#undef TAREFA_ID_STR
+    };
+
+    printf("\n#define TABELA_TAREFAS(X) \\\n");
+    for (int i = 0; i < NUM_TAREFAS; i++) {
+        printf("    X(%s, \"%s\", %u, %s, %s)%s\n", ids[i], tarefas[i].nome,
+               (unsigned) sugerida[i], tarefas[i].nome_banco, tarefas[i].nome_nucleo,
+               (i < NUM_TAREFAS - 1) ? " \\" : "");
+    }
+
+    vTaskDelete(NULL);
+}
+
+void iniciar_medicao_pilhas(void) {
+    xTaskCreateStatic(task_medicao_pilhas, "PilhasTask", PILHA_MEDICAO, NULL,
+                      tskIDLE_PRIORITY + 1, pilha_medicao, &tcb_medicao);
+}
+#else
+void iniciar_medicao_pilhas(void) {
+}
+#endif
@@ -0,0 +1,58 @@
+// ===========================================
+// FreeRTOSConfig.h (testes no host, port Posix)
+// ===========================================
+// Opções que os testes variam vêm do CMakeLists.txt como
+// definições de compilação, por isso ficam dentro de #ifndef.
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#define configUSE_PREEMPTION                    1
+#define configTICK_RATE_HZ                      1000
+#define configMAX_PRIORITIES                    8
+#define configMINIMAL_STACK_SIZE                256
+#define configTOTAL_HEAP_SIZE                   ( 1024 * 1024 )
+#define configMAX_TASK_NAME_LEN                 16
+#define configTICK_TYPE_WIDTH_IN_BITS           TICK_TYPE_WIDTH_32_BITS
+#define configUSE_IDLE_HOOK                     0
+
+#ifndef configUSE_TICK_HOOK
+#define configUSE_TICK_HOOK                     0
+#endif
+
+#define configUSE_MUTEXES                       1
+#define configUSE_RECURSIVE_MUTEXES             1
+#define configUSE_COUNTING_SEMAPHORES           1
+#define configUSE_TASK_NOTIFICATIONS            1
+#define configSUPPORT_STATIC_ALLOCATION         1
+#define configKERNEL_PROVIDED_STATIC_MEMORY     1
+#define configSUPPORT_DYNAMIC_ALLOCATION        1
+
+#define configUSE_TIMERS                        1
+#ifndef configTIMER_TASK_PRIORITY
+#define configTIMER_TASK_PRIORITY               ( configMAX_PRIORITIES - 1 )
+#endif
+#define configTIMER_QUEUE_LENGTH                32
+#define configTIMER_TASK_STACK_DEPTH            1024
+
+#define INCLUDE_vTaskDelay                      1
+#define INCLUDE_vTaskDelayUntil                 1
+#define INCLUDE_vTaskDelete                     1
+#define INCLUDE_vTaskSuspend                    1
+#define INCLUDE_xTaskGetSchedulerState          1
+#define INCLUDE_xTaskGetCurrentTaskHandle       1
+#define INCLUDE_xTimerPendFunctionCall          1
+
+// Asserts sempre ligados: uma falha encerra o teste com erro
+#ifndef __ASSEMBLER__
+#include <stdio.h>
+#include <stdlib.h>
+#define configASSERT( x )                                                   \
+    do {                                                                    \
+        if( !( x ) ) {                                                      \
+            fprintf( stderr, "FALHA: assert em %s:%d\n", __FILE__, __LINE__ ); \
+            abort();                                                        \
+        }                                                                   \
+    } while( 0 )
+#endif
+
+#endif // FREERTOS_CONFIG_H
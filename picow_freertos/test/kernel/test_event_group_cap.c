@@ -0,0 +1,92 @@
+// ===========================================
+// test_event_group_cap.c
+// ===========================================
+// xEventGroupSetBitsFromISR() com configEVENT_GROUP_ISR_MAX_WAKES = 1
+// e dois waiters de prioridade maior que a da tarefa de timers.
+// Quando o pedido passa do limite ele vai inteiro para a tarefa de
+// timers; um waiter não pode ser acordado ali e depois ver o seu bit
+// ainda ligado (com clear on exit) antes de a tarefa de timers rodar.
+#include <stdio.h>
+#include <stdlib.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "event_groups.h"
+
+#define BIT_A           0x01
+#define BIT_B           0x02
+
+#define TICK_DOIS       50      // 0x3: dois waiters, passa do limite
+#define TICK_UM         300     // 0x1: um waiter, caminho direto
+
+static EventGroupHandle_t grupo;
+static volatile int recebidos[ 2 ];
+static volatile int falhas_isr;
+
+typedef struct {
+    EventBits_t bit;
+    int indice;
+} waiter_t;
+
+static waiter_t waiters[] = {
+    { BIT_A, 0 },
+    { BIT_B, 1 },
+};
+
+void vApplicationTickHook( void ) {
+    static int enviados;
+    EventBits_t bits = 0;
+    BaseType_t acordou = pdFALSE;
+
+    TickType_t agora = xTaskGetTickCountFromISR();
+    if( agora == TICK_DOIS && enviados == 0 )
+        bits = BIT_A | BIT_B;
+    else if( agora == TICK_UM && enviados == 1 )
+        bits = BIT_A;
+
+    if( bits != 0 ) {
+        enviados++;
+        if( xEventGroupSetBitsFromISR( grupo, bits, &acordou ) != pdPASS )
+            falhas_isr++;
+    }
+}
+
+static void tarefa_waiter( void *params ) {
+    waiter_t *w = params;
+
+    for( ;; ) {
+        EventBits_t bits = xEventGroupWaitBits( grupo, w->bit, pdTRUE, pdFALSE, portMAX_DELAY );
+        if( bits & w->bit )
+            recebidos[ w->indice ]++;
+    }
+}
+
+static void tarefa_teste( void *params ) {
+    ( void ) params;
+
+    vTaskDelay( TICK_UM + 200 );
+
+    int erros = falhas_isr;
+    if( recebidos[ 0 ] != 2 || recebidos[ 1 ] != 1 ) {
+        printf( "recebidos A=%d B=%d (esperado A=2 B=1)\n", recebidos[ 0 ], recebidos[ 1 ] );
+        erros++;
+    }
+    if( xEventGroupGetBits( grupo ) != 0 ) {
+        printf( "bits restantes 0x%lx\n", ( unsigned long ) xEventGroupGetBits( grupo ) );
+        erros++;
+    }
+
+    printf( "%s\n", erros == 0 ? "PASS" : "FAIL" );
+    exit( erros == 0 ? 0 : 1 );
+}
+
+int main( void ) {
+    grupo = xEventGroupCreate();
+    configASSERT( grupo != NULL );
+
+    for( size_t i = 0; i < sizeof( waiters ) / sizeof( waiters[ 0 ] ); i++ )
+        xTaskCreate( tarefa_waiter, "waiter", configMINIMAL_STACK_SIZE * 4, &waiters[ i ], 5, NULL );
+    xTaskCreate( tarefa_teste, "teste", configMINIMAL_STACK_SIZE * 4, NULL, 1, NULL );
+
+    vTaskStartScheduler();
+    return 1;
+}
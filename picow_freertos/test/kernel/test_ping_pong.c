@@ -0,0 +1,80 @@
+// ===========================================
+// test_ping_pong.c
+// ===========================================
+// Benchmark de troca de contexto do port Posix: duas tarefas de
+// mesma prioridade se revezam por notificação durante DURACAO_TICKS
+// e o teste imprime as idas e voltas por segundo (duas trocas de
+// contexto cada).  Compilado uma vez com o caminho de sinais e outra
+// com configPOSIX_USE_FUTEX_SWITCH = 1; compare as duas linhas com
+//
+//   ctest --test-dir build_testes -R ping_pong -V
+//
+// O teste só falha se uma notificação se perder; o número depende
+// da máquina e não é conferido.
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define DURACAO_TICKS   pdMS_TO_TICKS( 2000 )
+#define AQUECIMENTO     pdMS_TO_TICKS( 100 )
+
+static TaskHandle_t ping;
+static TaskHandle_t pong;
+
+#if ( configPOSIX_USE_FUTEX_SWITCH == 1 )
+    #define CAMINHO     "futex"
+#else
+    #define CAMINHO     "sinais"
+#endif
+
+static double agora_s( void ) {
+    struct timespec t;
+    clock_gettime( CLOCK_MONOTONIC, &t );
+    return ( double ) t.tv_sec + ( double ) t.tv_nsec / 1e9;
+}
+
+static void tarefa_pong( void *params ) {
+    ( void ) params;
+
+    for( ;; ) {
+        ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+        xTaskNotifyGive( ping );
+    }
+}
+
+static void tarefa_ping( void *params ) {
+    ( void ) params;
+    unsigned long idas = 0;
+    int erros = 0;
+
+    vTaskDelay( AQUECIMENTO );
+
+    double inicio = agora_s();
+    TickType_t fim = xTaskGetTickCount() + DURACAO_TICKS;
+
+    while( xTaskGetTickCount() < fim ) {
+        xTaskNotifyGive( pong );
+        if( ulTaskNotifyTake( pdTRUE, pdMS_TO_TICKS( 1000 ) ) == 0 ) {
+            printf( "resposta %lu não chegou\n", idas );
+            erros++;
+            break;
+        }
+        idas++;
+    }
+
+    double segundos = agora_s() - inicio;
+    printf( "ping-pong (%s): %lu idas e voltas em %.2f s = %.0f/s\n",
+            CAMINHO, idas, segundos, ( double ) idas / segundos );
+
+    printf( "%s\n", erros == 0 && idas > 0 ? "PASS" : "FAIL" );
+    exit( erros == 0 && idas > 0 ? 0 : 1 );
+}
+
+int main( void ) {
+    xTaskCreate( tarefa_ping, "ping", configMINIMAL_STACK_SIZE * 4, NULL, 2, &ping );
+    xTaskCreate( tarefa_pong, "pong", configMINIMAL_STACK_SIZE * 4, NULL, 2, &pong );
+    vTaskStartScheduler();
+    return 1;
+}
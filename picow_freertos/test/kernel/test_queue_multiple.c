@@ -0,0 +1,179 @@
+// ===========================================
+// test_queue_multiple.c
+// ===========================================
+// xQueueSendMultiple()/xQueueReceiveMultiple(): rajadas que passam
+// do fim do armazenamento da fila, envio e recepção parciais com a
+// fila quase cheia ou quase vazia, e uma rajada acordando várias
+// tarefas bloqueadas de uma vez (uma por item) dos dois lados.
+#include <stdio.h>
+#include <stdlib.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+#define TAMANHO_FILA    8
+#define BLOQUEADAS      3
+
+static QueueHandle_t fila;
+static volatile int erros;
+static volatile int recebidos_tarefas;
+static volatile int enviados_tarefas;
+
+#define CONFERE( cond, ... )                \
+    do {                                    \
+        if( !( cond ) ) {                   \
+            printf( __VA_ARGS__ );          \
+            printf( "\n" );                 \
+            erros++;                        \
+        }                                   \
+    } while( 0 )
+
+// ------------------------------------------------------------
+// Fronteira do armazenamento e rajadas parciais
+// ------------------------------------------------------------
+static void testar_fronteira( void ) {
+    uint32_t itens[ 2 * TAMANHO_FILA ], lidos[ 2 * TAMANHO_FILA ];
+    UBaseType_t n;
+
+    // Leva os ponteiros de escrita e leitura para o índice 5
+    for( uint32_t v = 0; v < 5; v++ )
+        xQueueSend( fila, &v, 0 );
+    for( uint32_t v = 0; v < 5; v++ )
+        xQueueReceive( fila, &lidos[ 0 ], 0 );
+
+    // 8 itens: 3 até o fim do armazenamento e 5 depois da volta
+    for( uint32_t i = 0; i < TAMANHO_FILA; i++ )
+        itens[ i ] = 10 + i;
+    n = xQueueSendMultiple( fila, itens, TAMANHO_FILA, 0 );
+    CONFERE( n == TAMANHO_FILA, "envio com volta: %lu itens (esperado %d)", ( unsigned long ) n, TAMANHO_FILA );
+
+    n = xQueueSendMultiple( fila, itens, 3, 0 );
+    CONFERE( n == 0, "envio com a fila cheia: %lu itens", ( unsigned long ) n );
+
+    n = xQueueReceiveMultiple( fila, lidos, 3, 0 );
+    CONFERE( n == 3 && lidos[ 0 ] == 10 && lidos[ 2 ] == 12, "recepção de 3: %lu itens, %lu..%lu",
+             ( unsigned long ) n, ( unsigned long ) lidos[ 0 ], ( unsigned long ) lidos[ 2 ] );
+
+    // Só 3 dos 4 cabem
+    for( uint32_t i = 0; i < 4; i++ )
+        itens[ i ] = 20 + i;
+    n = xQueueSendMultiple( fila, itens, 4, 0 );
+    CONFERE( n == 3, "envio parcial: %lu itens (esperado 3)", ( unsigned long ) n );
+
+    // Pede mais do que há: volta só o que estava na fila, em ordem,
+    // atravessando o fim do armazenamento
+    n = xQueueReceiveMultiple( fila, lidos, 2 * TAMANHO_FILA, 0 );
+    CONFERE( n == TAMANHO_FILA, "recepção parcial: %lu itens (esperado %d)", ( unsigned long ) n, TAMANHO_FILA );
+    static const uint32_t esperado[ TAMANHO_FILA ] = { 13, 14, 15, 16, 17, 20, 21, 22 };
+    for( UBaseType_t i = 0; i < n && i < TAMANHO_FILA; i++ )
+        CONFERE( lidos[ i ] == esperado[ i ], "item %lu: %lu (esperado %lu)", ( unsigned long ) i,
+                 ( unsigned long ) lidos[ i ], ( unsigned long ) esperado[ i ] );
+
+    n = xQueueReceiveMultiple( fila, lidos, 1, 0 );
+    CONFERE( n == 0, "recepção com a fila vazia: %lu itens", ( unsigned long ) n );
+
+    // Com espera: vence o prazo sem nada
+    TickType_t inicio = xTaskGetTickCount();
+    n = xQueueReceiveMultiple( fila, lidos, 1, 20 );
+    CONFERE( n == 0 && xTaskGetTickCount() - inicio >= 20, "timeout da recepção: %lu itens", ( unsigned long ) n );
+}
+
+// ------------------------------------------------------------
+// Uma rajada acorda uma tarefa por item
+// ------------------------------------------------------------
+// Num núcleo as tarefas acordadas já terminaram quando a rajada
+// retorna; com dois, a outra pode ainda estar rodando.  Quem não foi
+// acordado só sai pelo timeout de 1000 ticks, bem depois daqui.
+static void esperar_contador( volatile int *contador, int alvo ) {
+    for( int i = 0; i < 100 && *contador < alvo; i++ )
+        vTaskDelay( 1 );
+}
+
+static void tarefa_receptora( void *params ) {
+    uint32_t v;
+    ( void ) params;
+
+    if( xQueueReceive( fila, &v, pdMS_TO_TICKS( 1000 ) ) == pdPASS )
+        recebidos_tarefas++;
+    vTaskDelete( NULL );
+}
+
+static void tarefa_emissora( void *params ) {
+    uint32_t v = 100;
+    ( void ) params;
+
+    if( xQueueSend( fila, &v, pdMS_TO_TICKS( 1000 ) ) == pdPASS )
+        enviados_tarefas++;
+    vTaskDelete( NULL );
+}
+
+static void tarefa_receptora_rajada( void *params ) {
+    uint32_t lidos[ TAMANHO_FILA ];
+    ( void ) params;
+
+    UBaseType_t n = xQueueReceiveMultiple( fila, lidos, TAMANHO_FILA, pdMS_TO_TICKS( 1000 ) );
+    CONFERE( n == BLOQUEADAS && lidos[ 0 ] == 0 && lidos[ BLOQUEADAS - 1 ] == BLOQUEADAS - 1,
+             "recepção bloqueada: %lu itens", ( unsigned long ) n );
+    recebidos_tarefas += ( int ) n;
+    vTaskDelete( NULL );
+}
+
+static void testar_acordar( void ) {
+    uint32_t itens[ TAMANHO_FILA ] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    UBaseType_t n;
+
+    // Receptoras de prioridade maior: cada uma roda até bloquear
+    for( int i = 0; i < BLOQUEADAS; i++ )
+        xTaskCreate( tarefa_receptora, "rx", configMINIMAL_STACK_SIZE * 4, NULL, 3, NULL );
+
+    n = xQueueSendMultiple( fila, itens, BLOQUEADAS, 0 );
+    CONFERE( n == BLOQUEADAS, "envio para receptoras: %lu itens", ( unsigned long ) n );
+    esperar_contador( &recebidos_tarefas, BLOQUEADAS );
+    CONFERE( recebidos_tarefas == BLOQUEADAS && uxQueueMessagesWaiting( fila ) == 0,
+             "receptoras acordadas: %d de %d, %lu itens na fila", recebidos_tarefas, BLOQUEADAS,
+             ( unsigned long ) uxQueueMessagesWaiting( fila ) );
+
+    // Emissoras bloqueadas com a fila cheia
+    n = xQueueSendMultiple( fila, itens, TAMANHO_FILA, 0 );
+    CONFERE( n == TAMANHO_FILA, "enchendo a fila: %lu itens", ( unsigned long ) n );
+    for( int i = 0; i < BLOQUEADAS; i++ )
+        xTaskCreate( tarefa_emissora, "tx", configMINIMAL_STACK_SIZE * 4, NULL, 3, NULL );
+
+    n = xQueueReceiveMultiple( fila, itens, BLOQUEADAS, 0 );
+    CONFERE( n == BLOQUEADAS, "recepção para emissoras: %lu itens", ( unsigned long ) n );
+    esperar_contador( &enviados_tarefas, BLOQUEADAS );
+    CONFERE( enviados_tarefas == BLOQUEADAS && uxQueueMessagesWaiting( fila ) == TAMANHO_FILA,
+             "emissoras acordadas: %d de %d, %lu itens na fila", enviados_tarefas, BLOQUEADAS,
+             ( unsigned long ) uxQueueMessagesWaiting( fila ) );
+    xQueueReset( fila );
+
+    // Uma receptora bloqueada em xQueueReceiveMultiple() leva a
+    // rajada inteira numa chamada
+    recebidos_tarefas = 0;
+    xTaskCreate( tarefa_receptora_rajada, "rx_rajada", configMINIMAL_STACK_SIZE * 4, NULL, 3, NULL );
+    for( uint32_t i = 0; i < TAMANHO_FILA; i++ )
+        itens[ i ] = i;
+    n = xQueueSendMultiple( fila, itens, BLOQUEADAS, 0 );
+    esperar_contador( &recebidos_tarefas, BLOQUEADAS );
+    CONFERE( n == BLOQUEADAS && recebidos_tarefas == BLOQUEADAS, "rajada para receptora bloqueada: %d itens",
+             recebidos_tarefas );
+}
+
+static void tarefa_teste( void *params ) {
+    ( void ) params;
+
+    testar_fronteira();
+    testar_acordar();
+
+    printf( "%s\n", erros == 0 ? "PASS" : "FAIL" );
+    exit( erros == 0 ? 0 : 1 );
+}
+
+int main( void ) {
+    fila = xQueueCreate( TAMANHO_FILA, sizeof( uint32_t ) );
+    configASSERT( fila != NULL );
+
+    xTaskCreate( tarefa_teste, "teste", configMINIMAL_STACK_SIZE * 4, NULL, 1, NULL );
+    vTaskStartScheduler();
+    return 1;
+}
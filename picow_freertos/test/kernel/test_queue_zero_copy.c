@@ -0,0 +1,159 @@
+// ===========================================
+// test_queue_zero_copy.c
+// ===========================================
+// xQueueReserve()/xQueueCommit() e xQueueAcquire()/xQueueRelease()
+// no padrão do log serial: várias tarefas formatam direto no slot
+// reservado sem esperar (e contam o descarte quando ele está ocupado)
+// e uma consumidora lê cada linha no lugar.  Confere também que um
+// slot reservado segura as outras reservas, que quem esperava é
+// acordado no commit e que o dono volta a ser livre depois dele.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+#define LINHA_MAX       32
+#define TAMANHO_FILA    4
+#define PRODUTORAS      3
+#define LINHAS          2000
+
+static QueueHandle_t fila;
+static volatile int erros;
+static volatile uint32_t descartadas;
+static volatile uint32_t recebidas;
+static volatile int produtoras_fim;
+static volatile int reservou_esperando;
+static TaskHandle_t tarefa_principal;
+
+#define CONFERE( cond, ... )                \
+    do {                                    \
+        if( !( cond ) ) {                   \
+            printf( __VA_ARGS__ );          \
+            printf( "\n" );                 \
+            erros++;                        \
+        }                                   \
+    } while( 0 )
+
+// ------------------------------------------------------------
+// Reserva segurando as outras
+// ------------------------------------------------------------
+static void tarefa_reserva_esperando( void *params ) {
+    char *slot;
+    ( void ) params;
+
+    if( xQueueReserve( fila, ( void ** ) &slot, pdMS_TO_TICKS( 1000 ) ) == pdPASS ) {
+        strcpy( slot, "segunda" );
+        xQueueCommit( fila, slot );
+        reservou_esperando = 1;
+    }
+    vTaskDelete( NULL );
+}
+
+static void testar_reserva( void ) {
+    char *slot, *outro, *item;
+
+    CONFERE( xQueueReserve( fila, ( void ** ) &slot, 0 ) == pdPASS, "primeira reserva falhou" );
+    CONFERE( xQueueReserve( fila, ( void ** ) &outro, 0 ) == errQUEUE_FULL, "segunda reserva passou" );
+
+    // Prioridade maior: bloqueia na reserva até o commit
+    xTaskCreate( tarefa_reserva_esperando, "reserva", configMINIMAL_STACK_SIZE * 4, NULL, 3, NULL );
+    CONFERE( reservou_esperando == 0, "reserva passou com o slot ocupado" );
+
+    strcpy( slot, "primeira" );
+    xQueueCommit( fila, slot );
+    vTaskDelay( 10 );
+    CONFERE( reservou_esperando == 1, "tarefa esperando não reservou depois do commit" );
+
+    const char *esperado[] = { "primeira", "segunda" };
+    for( int i = 0; i < 2; i++ ) {
+        CONFERE( xQueueAcquire( fila, ( void ** ) &item, 0 ) == pdPASS && strcmp( item, esperado[ i ] ) == 0,
+                 "item %d: esperado '%s'", i, esperado[ i ] );
+        xQueueRelease( fila, item );
+    }
+}
+
+// ------------------------------------------------------------
+// Várias produtoras sem espera, uma consumidora
+// ------------------------------------------------------------
+static void tarefa_produtora( void *params ) {
+    int id = ( int ) ( intptr_t ) params;
+    char *linha;
+
+    for( int i = 0; i < LINHAS; i++ ) {
+        if( xQueueReserve( fila, ( void ** ) &linha, 0 ) != pdPASS ) {
+            taskENTER_CRITICAL();
+            descartadas++;
+            taskEXIT_CRITICAL();
+        } else {
+            snprintf( linha, LINHA_MAX, "p%d:%d", id, i );
+            xQueueCommit( fila, linha );
+        }
+        if( ( i % 16 ) == 0 )
+            taskYIELD();
+    }
+
+    taskENTER_CRITICAL();
+    produtoras_fim++;
+    taskEXIT_CRITICAL();
+    vTaskDelete( NULL );
+}
+
+static void tarefa_consumidora( void *params ) {
+    int ultimo[ PRODUTORAS ] = { -1, -1, -1 };
+    char *linha;
+    int id, i;
+    ( void ) params;
+
+    for( ;; ) {
+        if( xQueueAcquire( fila, ( void ** ) &linha, pdMS_TO_TICKS( 100 ) ) != pdPASS ) {
+            if( produtoras_fim == PRODUTORAS )
+                break;
+            continue;
+        }
+
+        // Cada produtora em ordem, sem linha corrompida
+        if( sscanf( linha, "p%d:%d", &id, &i ) != 2 || id < 0 || id >= PRODUTORAS || i <= ultimo[ id ] ) {
+            printf( "linha inválida: '%s'\n", linha );
+            erros++;
+        } else {
+            ultimo[ id ] = i;
+        }
+        xQueueRelease( fila, linha );
+        recebidas++;
+    }
+
+    xTaskNotifyGive( tarefa_principal );
+    vTaskDelete( NULL );
+}
+
+static void testar_produtoras( void ) {
+    xTaskCreate( tarefa_consumidora, "cons", configMINIMAL_STACK_SIZE * 4, NULL, 2, NULL );
+    for( int p = 0; p < PRODUTORAS; p++ )
+        xTaskCreate( tarefa_produtora, "prod", configMINIMAL_STACK_SIZE * 4, ( void * ) ( intptr_t ) p, 2, NULL );
+
+    CONFERE( ulTaskNotifyTake( pdTRUE, pdMS_TO_TICKS( 20000 ) ) != 0, "consumidora não terminou" );
+    CONFERE( recebidas + descartadas == PRODUTORAS * LINHAS && recebidas > 0,
+             "%lu recebidas + %lu descartadas (esperado %d)", ( unsigned long ) recebidas,
+             ( unsigned long ) descartadas, PRODUTORAS * LINHAS );
+}
+
+static void tarefa_teste( void *params ) {
+    ( void ) params;
+
+    testar_reserva();
+    testar_produtoras();
+
+    printf( "%s\n", erros == 0 ? "PASS" : "FAIL" );
+    exit( erros == 0 ? 0 : 1 );
+}
+
+int main( void ) {
+    fila = xQueueCreate( TAMANHO_FILA, LINHA_MAX );
+    configASSERT( fila != NULL );
+
+    xTaskCreate( tarefa_teste, "teste", configMINIMAL_STACK_SIZE * 4, NULL, 1, &tarefa_principal );
+    vTaskStartScheduler();
+    return 1;
+}
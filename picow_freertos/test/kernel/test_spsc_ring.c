@@ -0,0 +1,189 @@
+// ===========================================
+// test_spsc_ring.c
+// ===========================================
+// Anel SPSC: cheio/vazio e ordem num anel pequeno, depois uma tarefa
+// produtora e o tick hook (como interrupção) empurrando sequências
+// numeradas para consumidores bloqueados em xSpscRingReceive().  Um
+// item fora de ordem ou perdido, ou um consumidor que não acorda,
+// falha o teste.
+#include <stdio.h>
+#include <stdlib.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "spsc_ring.h"
+
+#define ITENS_TAREFA    200000
+#define ITENS_ISR       500
+#define TAMANHO_ANEL    16
+
+static uint8_t armazenamento_tarefa[ spscringSTORAGE_SIZE( sizeof( uint32_t ), TAMANHO_ANEL ) ];
+static StaticSpscRing_t estrutura_tarefa;
+static SpscRingHandle_t anel_tarefa;
+
+static uint8_t armazenamento_isr[ spscringSTORAGE_SIZE( sizeof( uint32_t ), TAMANHO_ANEL ) ];
+static StaticSpscRing_t estrutura_isr;
+static SpscRingHandle_t anel_isr;
+
+static volatile int isr_ativa;
+static volatile uint32_t enviados_isr;
+static volatile int erros;
+
+static TaskHandle_t tarefa_principal;
+
+void vApplicationTickHook( void ) {
+    BaseType_t acordou = pdFALSE;
+
+    if( !isr_ativa || enviados_isr == ITENS_ISR )
+        return;
+
+    uint32_t v = enviados_isr;
+    if( xSpscRingPushFromISR( anel_isr, &v, &acordou ) == pdPASS )
+        enviados_isr++;
+}
+
+// ------------------------------------------------------------
+// Sem tarefas bloqueadas: limites do anel
+// ------------------------------------------------------------
+static void testar_limites( void ) {
+    static uint8_t armazenamento[ spscringSTORAGE_SIZE( sizeof( uint32_t ), 4 ) ];
+    static StaticSpscRing_t estrutura;
+    SpscRingHandle_t anel = xSpscRingCreateStatic( sizeof( uint32_t ), 4, armazenamento, &estrutura );
+    uint32_t v;
+
+    // Várias voltas, para os índices passarem do fim do armazenamento
+    for( uint32_t volta = 0; volta < 3; volta++ ) {
+        for( v = 0; v < 4; v++ ) {
+            if( xSpscRingPush( anel, &v ) != pdPASS ) {
+                printf( "volta %lu: push %lu falhou com o anel livre\n", ( unsigned long ) volta, ( unsigned long ) v );
+                erros++;
+            }
+        }
+
+        v = 99;
+        if( xSpscRingPush( anel, &v ) != pdFAIL ) {
+            printf( "volta %lu: push com o anel cheio passou\n", ( unsigned long ) volta );
+            erros++;
+        }
+        if( uxSpscRingItemsWaiting( anel ) != 4 ) {
+            printf( "volta %lu: %lu itens (esperado 4)\n", ( unsigned long ) volta,
+                    ( unsigned long ) uxSpscRingItemsWaiting( anel ) );
+            erros++;
+        }
+
+        for( uint32_t esperado = 0; esperado < 4; esperado++ ) {
+            if( xSpscRingPop( anel, &v ) != pdPASS || v != esperado ) {
+                printf( "volta %lu: pop %lu deu %lu\n", ( unsigned long ) volta,
+                        ( unsigned long ) esperado, ( unsigned long ) v );
+                erros++;
+            }
+        }
+
+        if( xSpscRingPop( anel, &v ) != pdFAIL ) {
+            printf( "volta %lu: pop com o anel vazio passou\n", ( unsigned long ) volta );
+            erros++;
+        }
+    }
+}
+
+// ------------------------------------------------------------
+// Tarefa -> tarefa
+// ------------------------------------------------------------
+static void tarefa_produtora( void *params ) {
+    ( void ) params;
+
+    for( uint32_t v = 0; v < ITENS_TAREFA; ) {
+        if( xSpscRingPush( anel_tarefa, &v ) == pdPASS )
+            v++;
+        else
+            taskYIELD();
+    }
+
+    vTaskDelete( NULL );
+}
+
+static void tarefa_consumidora( void *params ) {
+    ( void ) params;
+    uint32_t v;
+
+    for( uint32_t esperado = 0; esperado < ITENS_TAREFA; esperado++ ) {
+        if( xSpscRingReceive( anel_tarefa, &v, pdMS_TO_TICKS( 1000 ) ) != pdPASS ) {
+            printf( "tarefa: item %lu não chegou\n", ( unsigned long ) esperado );
+            erros++;
+            break;
+        }
+        if( v != esperado ) {
+            printf( "tarefa: recebido %lu (esperado %lu)\n", ( unsigned long ) v, ( unsigned long ) esperado );
+            erros++;
+            break;
+        }
+    }
+
+    xTaskNotifyGiveIndexed( tarefa_principal, 0 );
+    vTaskDelete( NULL );
+}
+
+// ------------------------------------------------------------
+// Interrupção (tick hook) -> tarefa
+// ------------------------------------------------------------
+static void tarefa_consumidora_isr( void *params ) {
+    ( void ) params;
+    uint32_t v;
+
+    for( uint32_t esperado = 0; esperado < ITENS_ISR; esperado++ ) {
+        if( xSpscRingReceive( anel_isr, &v, pdMS_TO_TICKS( 1000 ) ) != pdPASS ) {
+            printf( "isr: item %lu não chegou\n", ( unsigned long ) esperado );
+            erros++;
+            break;
+        }
+        if( v != esperado ) {
+            printf( "isr: recebido %lu (esperado %lu)\n", ( unsigned long ) v, ( unsigned long ) esperado );
+            erros++;
+            break;
+        }
+    }
+
+    xTaskNotifyGiveIndexed( tarefa_principal, 0 );
+    vTaskDelete( NULL );
+}
+
+static void tarefa_teste( void *params ) {
+    ( void ) params;
+    TaskHandle_t consumidora;
+
+    testar_limites();
+
+    // O consumidor acorda pelo índice 1, como faria uma tarefa que
+    // também usa stream buffers, e é registrado antes de rodar
+    vTaskSuspendAll();
+    xTaskCreate( tarefa_consumidora, "cons", configMINIMAL_STACK_SIZE * 4, NULL, 3, &consumidora );
+    vSpscRingSetConsumerTask( anel_tarefa, consumidora, 1 );
+    ( void ) xTaskResumeAll();
+    xTaskCreate( tarefa_produtora, "prod", configMINIMAL_STACK_SIZE * 4, NULL, 2, NULL );
+    if( ulTaskNotifyTakeIndexed( 0, pdTRUE, pdMS_TO_TICKS( 30000 ) ) == 0 ) {
+        printf( "tarefa: consumidor não terminou\n" );
+        erros++;
+    }
+
+    vTaskSuspendAll();
+    xTaskCreate( tarefa_consumidora_isr, "cons_isr", configMINIMAL_STACK_SIZE * 4, NULL, 3, &consumidora );
+    vSpscRingSetConsumerTask( anel_isr, consumidora, 1 );
+    ( void ) xTaskResumeAll();
+    isr_ativa = 1;
+    if( ulTaskNotifyTakeIndexed( 0, pdTRUE, pdMS_TO_TICKS( 10000 ) ) == 0 ) {
+        printf( "isr: consumidor não terminou\n" );
+        erros++;
+    }
+
+    printf( "%s\n", erros == 0 ? "PASS" : "FAIL" );
+    exit( erros == 0 ? 0 : 1 );
+}
+
+int main( void ) {
+    anel_tarefa = xSpscRingCreateStatic( sizeof( uint32_t ), TAMANHO_ANEL, armazenamento_tarefa, &estrutura_tarefa );
+    anel_isr = xSpscRingCreateStatic( sizeof( uint32_t ), TAMANHO_ANEL, armazenamento_isr, &estrutura_isr );
+    configASSERT( anel_tarefa != NULL && anel_isr != NULL );
+
+    xTaskCreate( tarefa_teste, "teste", configMINIMAL_STACK_SIZE * 4, NULL, 1, &tarefa_principal );
+    vTaskStartScheduler();
+    return 1;
+}
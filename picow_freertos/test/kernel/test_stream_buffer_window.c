@@ -0,0 +1,229 @@
+// ===========================================
+// test_stream_buffer_window.c
+// ===========================================
+// Janelas de escrita e leitura sem cópia dos stream buffers: janelas
+// que passam do fim do armazenamento (duas regiões), commits menores
+// que a janela, as versões FromISR chamadas do tick hook acordando
+// uma tarefa bloqueada, a espera de xMinimumBytes livres e a janela
+// de um message buffer.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stream_buffer.h"
+#include "message_buffer.h"
+
+#define CAPACIDADE      16
+
+static StreamBufferHandle_t stream;
+static volatile int erros;
+static volatile int etapa_isr;          // o que o tick hook faz agora
+static volatile size_t comprometido_isr;
+
+#define CONFERE( cond, ... )                \
+    do {                                    \
+        if( !( cond ) ) {                   \
+            printf( __VA_ARGS__ );          \
+            printf( "\n" );                 \
+            erros++;                        \
+        }                                   \
+    } while( 0 )
+
+// Escreve n bytes com valores a partir de 'base' numa janela
+static void preencher( const StreamBufferWindow_t *j, size_t n, uint8_t base ) {
+    for( size_t i = 0; i < n; i++ ) {
+        if( i < j->xFirstLength )
+            j->pucFirst[ i ] = ( uint8_t ) ( base + i );
+        else
+            j->pucSecond[ i - j->xFirstLength ] = ( uint8_t ) ( base + i );
+    }
+}
+
+static uint8_t byte_da_janela( const StreamBufferWindow_t *j, size_t i ) {
+    return ( i < j->xFirstLength ) ? j->pucFirst[ i ] : j->pucSecond[ i - j->xFirstLength ];
+}
+
+// ------------------------------------------------------------
+// Janelas com volta e commits parciais
+// ------------------------------------------------------------
+static void testar_volta( void ) {
+    StreamBufferWindow_t j;
+    uint8_t dados[ CAPACIDADE ];
+    size_t n;
+
+    // Leva cabeça e cauda para o índice 10
+    memset( dados, 0xEE, sizeof( dados ) );
+    xStreamBufferSend( stream, dados, 10, 0 );
+    xStreamBufferReceive( stream, dados, 10, 0 );
+
+    // Janela de escrita com todo o buffer livre: passa do fim
+    n = xStreamBufferGetWriteWindow( stream, &j, 1, 0 );
+    CONFERE( n == CAPACIDADE && j.xFirstLength + j.xSecondLength == n,
+             "janela de escrita: %lu bytes (%lu + %lu)", ( unsigned long ) n,
+             ( unsigned long ) j.xFirstLength, ( unsigned long ) j.xSecondLength );
+    CONFERE( j.pucSecond != NULL && j.xSecondLength > 0 && j.xFirstLength < 12,
+             "janela de escrita sem segunda região (%lu + %lu)",
+             ( unsigned long ) j.xFirstLength, ( unsigned long ) j.xSecondLength );
+
+    // Commit menor que a janela, mas que ainda atravessa a volta
+    preencher( &j, n, 0 );
+    n = xStreamBufferCommitWrite( stream, 12 );
+    CONFERE( n == 12 && xStreamBufferBytesAvailable( stream ) == 12,
+             "commit de escrita parcial: %lu, %lu disponíveis", ( unsigned long ) n,
+             ( unsigned long ) xStreamBufferBytesAvailable( stream ) );
+
+    n = xStreamBufferReceive( stream, dados, sizeof( dados ), 0 );
+    CONFERE( n == 12, "leitura do commit: %lu bytes", ( unsigned long ) n );
+    for( size_t i = 0; i < n; i++ )
+        CONFERE( dados[ i ] == i, "byte %lu: %u (esperado %lu)", ( unsigned long ) i, dados[ i ], ( unsigned long ) i );
+
+    // Janela de leitura sobre dados que passam do fim
+    for( size_t i = 0; i < 14; i++ )
+        dados[ i ] = ( uint8_t ) ( 100 + i );
+    xStreamBufferSend( stream, dados, 14, 0 );
+
+    n = xStreamBufferGetReadWindow( stream, &j, 0 );
+    CONFERE( n == 14 && j.xFirstLength + j.xSecondLength == 14 && j.xSecondLength > 0,
+             "janela de leitura: %lu bytes (%lu + %lu)", ( unsigned long ) n,
+             ( unsigned long ) j.xFirstLength, ( unsigned long ) j.xSecondLength );
+    for( size_t i = 0; i < n; i++ )
+        CONFERE( byte_da_janela( &j, i ) == 100 + i, "janela de leitura, byte %lu: %u", ( unsigned long ) i,
+                 byte_da_janela( &j, i ) );
+
+    // Consome só parte: o resto continua lá, na mesma ordem
+    n = xStreamBufferCommitRead( stream, 5 );
+    CONFERE( n == 5 && xStreamBufferBytesAvailable( stream ) == 9,
+             "commit de leitura parcial: %lu, %lu disponíveis", ( unsigned long ) n,
+             ( unsigned long ) xStreamBufferBytesAvailable( stream ) );
+    n = xStreamBufferGetReadWindow( stream, &j, 0 );
+    CONFERE( n == 9 && byte_da_janela( &j, 0 ) == 105 && byte_da_janela( &j, 8 ) == 113,
+             "janela depois do commit parcial: %lu bytes", ( unsigned long ) n );
+    xStreamBufferCommitRead( stream, n );
+
+    n = xStreamBufferGetReadWindow( stream, &j, 0 );
+    CONFERE( n == 0 && j.xFirstLength == 0 && j.xSecondLength == 0,
+             "janela de leitura vazia: %lu bytes", ( unsigned long ) n );
+}
+
+// ------------------------------------------------------------
+// FromISR a partir do tick hook
+// ------------------------------------------------------------
+void vApplicationTickHook( void ) {
+    StreamBufferWindow_t j;
+    BaseType_t acordou = pdFALSE;
+
+    if( etapa_isr == 1 ) {
+        // Escreve 4 bytes para a tarefa bloqueada em Receive
+        if( xStreamBufferGetWriteWindow( stream, &j, 4, 0 ) >= 4 ) {
+            preencher( &j, 4, 50 );
+            comprometido_isr = xStreamBufferCommitWriteFromISR( stream, 4, &acordou );
+            etapa_isr = 0;
+        }
+    } else if( etapa_isr == 2 ) {
+        // Libera 6 bytes para a tarefa bloqueada em Send
+        if( xStreamBufferGetReadWindow( stream, &j, 0 ) >= 6 ) {
+            comprometido_isr = xStreamBufferCommitReadFromISR( stream, 6, &acordou );
+            etapa_isr = 0;
+        }
+    }
+}
+
+static void testar_isr( void ) {
+    uint8_t dados[ CAPACIDADE ];
+    size_t n;
+
+    xStreamBufferReset( stream );
+
+    etapa_isr = 1;
+    n = xStreamBufferReceive( stream, dados, sizeof( dados ), pdMS_TO_TICKS( 1000 ) );
+    CONFERE( n == 4 && comprometido_isr == 4 && dados[ 0 ] == 50 && dados[ 3 ] == 53,
+             "commit de escrita da ISR: %lu bytes recebidos", ( unsigned long ) n );
+
+    // Enche e espera a ISR abrir espaço
+    memset( dados, 0, sizeof( dados ) );
+    xStreamBufferSend( stream, dados, CAPACIDADE, 0 );
+    etapa_isr = 2;
+    n = xStreamBufferSend( stream, dados, 6, pdMS_TO_TICKS( 1000 ) );
+    CONFERE( n == 6 && comprometido_isr == 6, "commit de leitura da ISR: %lu bytes enviados", ( unsigned long ) n );
+    xStreamBufferReset( stream );
+}
+
+// ------------------------------------------------------------
+// Espera por xMinimumBytes livres
+// ------------------------------------------------------------
+static void tarefa_leitora( void *params ) {
+    uint8_t dados[ 8 ];
+    ( void ) params;
+
+    // Libera o espaço aos poucos: 3 bytes não bastam para quem
+    // espera 8, os 3 seguintes ainda não, os 3 últimos sim
+    for( int i = 0; i < 3; i++ ) {
+        vTaskDelay( 10 );
+        xStreamBufferReceive( stream, dados, 3, 0 );
+    }
+    vTaskDelete( NULL );
+}
+
+static void testar_espera( void ) {
+    StreamBufferWindow_t j;
+    uint8_t dados[ CAPACIDADE ] = { 0 };
+
+    xStreamBufferSend( stream, dados, CAPACIDADE, 0 );
+    xTaskCreate( tarefa_leitora, "leitora", configMINIMAL_STACK_SIZE * 4, NULL, 2, NULL );
+
+    TickType_t inicio = xTaskGetTickCount();
+    size_t n = xStreamBufferGetWriteWindow( stream, &j, 8, pdMS_TO_TICKS( 1000 ) );
+    TickType_t espera = xTaskGetTickCount() - inicio;
+    CONFERE( n >= 8 && espera >= 25, "janela de 8 bytes: %lu livres depois de %lu ticks",
+             ( unsigned long ) n, ( unsigned long ) espera );
+    xStreamBufferReset( stream );
+}
+
+// ------------------------------------------------------------
+// Message buffer: a janela é a mensagem, sem o cabeçalho
+// ------------------------------------------------------------
+static void testar_mensagem( void ) {
+    MessageBufferHandle_t mb = xMessageBufferCreate( 32 );
+    StreamBufferWindow_t j;
+    uint8_t dados[ 32 ];
+
+    size_t n = xMessageBufferGetWriteWindow( mb, &j, 5, 0 );
+    CONFERE( n >= 5, "janela de mensagem: %lu bytes", ( unsigned long ) n );
+    preencher( &j, 5, 70 );
+    xMessageBufferCommitWrite( mb, 5 );
+
+    xMessageBufferSend( mb, "abc", 3, 0 );
+
+    n = xMessageBufferGetReadWindow( mb, &j, 0 );
+    CONFERE( n == 5 && byte_da_janela( &j, 0 ) == 70 && byte_da_janela( &j, 4 ) == 74,
+             "primeira mensagem pela janela: %lu bytes", ( unsigned long ) n );
+    n = xMessageBufferCommitRead( mb );
+    CONFERE( n == 5, "commit da mensagem: %lu", ( unsigned long ) n );
+
+    n = xMessageBufferReceive( mb, dados, sizeof( dados ), 0 );
+    CONFERE( n == 3 && memcmp( dados, "abc", 3 ) == 0, "segunda mensagem: %lu bytes", ( unsigned long ) n );
+
+    vMessageBufferDelete( mb );
+}
+
+static void tarefa_teste( void *params ) {
+    ( void ) params;
+
+    testar_volta();
+    testar_isr();
+    testar_espera();
+    testar_mensagem();
+
+    printf( "%s\n", erros == 0 ? "PASS" : "FAIL" );
+    exit( erros == 0 ? 0 : 1 );
+}
+
+int main( void ) {
+    stream = xStreamBufferCreate( CAPACIDADE, 1 );
+    configASSERT( stream != NULL );
+
+    xTaskCreate( tarefa_teste, "teste", configMINIMAL_STACK_SIZE * 4, NULL, 1, NULL );
+    vTaskStartScheduler();
+    return 1;
+}
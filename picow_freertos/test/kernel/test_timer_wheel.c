@@ -0,0 +1,90 @@
+// ===========================================
+// test_timer_wheel.c
+// ===========================================
+// Com configTIMER_WHEEL_SLOT_BITS = 2 e configTIMER_WHEEL_LEVELS = 2
+// a roda alcança 16 ticks.  Timers com período maior ficam
+// estacionados no nível de cima e são refeitos a cada volta dele;
+// nenhum pode expirar antes da hora (nem disparar o configASSERT de
+// prvProcessExpiredTimer).
+#include <stdio.h>
+#include <stdlib.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+#define ATRASO_MAX      20      // folga para o host atrasar a tarefa de timers
+#define DISPAROS        5
+
+typedef struct {
+    TickType_t periodo;
+    TickType_t inicio;
+    int disparos;
+    int erros;
+} teste_timer_t;
+
+static teste_timer_t testes[] = {
+    { 5,   0, 0, 0 },       // dentro do alcance
+    { 16,  0, 0, 0 },       // exatamente no alcance
+    { 37,  0, 0, 0 },       // duas voltas do nível de cima
+    { 100, 0, 0, 0 },       // seis voltas
+    { 1000, 0, 0, 0 },
+};
+#define NUM_TESTES  ( sizeof( testes ) / sizeof( testes[ 0 ] ) )
+
+static void callback( TimerHandle_t timer ) {
+    teste_timer_t *t = pvTimerGetTimerID( timer );
+    TickType_t agora = xTaskGetTickCount();
+    TickType_t esperado = t->inicio + t->periodo * ( TickType_t ) ( t->disparos + 1 );
+
+    if( agora < esperado || agora > esperado + ATRASO_MAX ) {
+        printf( "periodo %lu: disparo %d no tick %lu (esperado %lu)\n",
+                ( unsigned long ) t->periodo, t->disparos + 1,
+                ( unsigned long ) agora, ( unsigned long ) esperado );
+        t->erros++;
+    }
+
+    if( ++t->disparos == DISPAROS )
+        xTimerStop( timer, 0 );
+}
+
+static void tarefa_teste( void *params ) {
+    ( void ) params;
+    TimerHandle_t timers[ NUM_TESTES ];
+
+    // Começa fora do alinhamento dos slots
+    vTaskDelay( 3 );
+
+    for( size_t i = 0; i < NUM_TESTES; i++ ) {
+        timers[ i ] = xTimerCreate( "t", testes[ i ].periodo, pdTRUE, &testes[ i ], callback );
+        configASSERT( timers[ i ] != NULL );
+    }
+
+    // Todos partem do mesmo tick (a tarefa de timers tem prioridade maior)
+    vTaskSuspendAll();
+    for( size_t i = 0; i < NUM_TESTES; i++ ) {
+        testes[ i ].inicio = xTaskGetTickCount();
+        xTimerStart( timers[ i ], 0 );
+    }
+    ( void ) xTaskResumeAll();
+
+    vTaskDelay( 1000 * DISPAROS + 2 * ATRASO_MAX );
+
+    int erros = 0;
+    for( size_t i = 0; i < NUM_TESTES; i++ ) {
+        if( testes[ i ].disparos != DISPAROS ) {
+            printf( "periodo %lu: %d disparos (esperado %d)\n",
+                    ( unsigned long ) testes[ i ].periodo, testes[ i ].disparos, DISPAROS );
+            erros++;
+        }
+        erros += testes[ i ].erros;
+    }
+
+    printf( "%s\n", erros == 0 ? "PASS" : "FAIL" );
+    exit( erros == 0 ? 0 : 1 );
+}
+
+int main( void ) {
+    xTaskCreate( tarefa_teste, "teste", configMINIMAL_STACK_SIZE * 4, NULL, 1, NULL );
+    vTaskStartScheduler();
+    return 1;
+}